@@ -12,6 +12,7 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <memory>
+#include <atomic>
 #include <unistd.h>
 #include <pthread.h>
 #include <stdio.h>
@@ -27,14 +28,24 @@
 #include <cassert>
 #include <g2d.h>
 #include "lvgl/lvgl.h"
-#include "lvgl/src/widgets/lv_canvas.h"
-#include "lv_drivers/indev/evdev.h"
-#include "lv_drivers/display/drm.h"
 #include "lv_drivers/indev/evdev.h"
+/* opened by evdev_init(), not declared in evdev.h */
+extern "C" int evdev_fd;
 #include "gui_guider.h"
 #include "events_init.h"
 #include "src/custom/custom.h"
 #include "ml/yolov4_tflite.h"
+#include "ml/ml_config.h"
+#include "ml/model_reloader.h"
+#include "ml/inference_pool.h"
+#include "ml/two_stage_detector.h"
+#include "ml/overlay_sync.h"
+#include "ml/latest_value.h"
+#include "ml/mpsc_queue.h"
+#include "ml/roi_scheduler.h"
+#include "ml/g2d_input.h"
+#include "ml/detection_journal.h"
+#include "ml/inventory.h"
 #include "matter/log_parse.h"
 
 #include <sys/ipc.h>
@@ -50,11 +61,6 @@ typedef struct {
 
 //#define DEBUG
 
-// for LVGL of DRM boot
-#define H_RES (800)
-#define V_RES (480)
-#define DISP_BUF_SIZE (800 * 480)
-
 //for getting buffer
 #define CAPTURE_BUF_SIZE 4
 #define CLEAR(x) memset(&(x), 0, sizeof(x))
@@ -63,15 +69,31 @@ typedef struct {
 #define WIDTH 640
 #define HEIGHT 480
 
-#define LVGL_REFRESH_DELAY_US 5000
+// commands of the other threads waiting for the UI loop
+#define UI_COMMAND_QUEUE_LEN 64
+// command queue statistics, refreshed every UI_STATS_PERIOD_US
+#define UI_STATS_PATH "/tmp/ui_queue.txt"
+#define UI_STATS_PERIOD_US 10000000
+// converted camera frames, see camera_free_slot()
+#define CAMERA_SLOTS 4
+// images of the screens in builds with ASSET_PACK=1, written by tools/pack_assets.py
+#define ASSET_PACK_PATH "/usr/share/lvgl_demo/assets.bin"
 
 // ML
 #define MAXOBJ 20
-
-// mutex, condition and read/write lock
+#define ML_CONFIG_PATH "/usr/share/ml_model/ml.conf"
+// operator profile, refreshed every ML_PROFILE_PERIOD inferences and on SIGUSR1
+#define ML_PROFILE_PATH "/tmp/ml_profile.txt"
+#define ML_PROFILE_PERIOD 300
+// region of interest statistics, refreshed every ML_ROI_STATS_PERIOD inferences
+#define ML_ROI_STATS_PATH "/tmp/ml_roi.txt"
+#define ML_ROI_STATS_PERIOD 100
+// inventory per class with the age of its oldest item, refreshed when it changes
+#define ML_INVENTORY_PATH "/tmp/ml_inventory.txt"
+
+// mutex and condition of the ML thread
 static pthread_mutex_t mutex_ml = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t ml_cond = PTHREAD_COND_INITIALIZER;
-static pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
 
 static int video_fd = 0;
 static const char *video_devname = "/dev/video0";
@@ -80,39 +102,59 @@ volatile bool g_ui_camera = false;
 volatile bool light_ctl_flag = true;
 FILE *matter_handle = NULL;
 static void *handle = NULL; /* g2d handler */
-static struct g2d_buf *g_sbuf, *g_dbuf; /* g2d src/dst buffer */
-static uint8_t *g_src_buf; /* buffer for rendering and ml */
+static struct g2d_buf *g_sbuf; /* g2d src buffer */
+/* converted frames for rendering and ml, the ml input is blitted from them */
+static struct g2d_buf *g_src_g2d[CAMERA_SLOTS];
+/* who uses which slot, only held to update it, never while copying */
+static std::mutex g_src_lock;
+static int g_src_latest = -1; /* newest frame, the next one the ML thread takes */
+static int g_src_ml = -1; /* read by the ML thread */
+static int g_src_shown = -1; /* on the preview */
+static int g_src_queued[CAMERA_SLOTS]; /* frame commands the UI loop did not run yet */
+static uint64_t g_src_seq, g_src_ts_us; /* camera frame in the latest slot and its capture time */
+static std::atomic<uint64_t> g_src_dropped(0); /* frames without a free slot */
 #ifdef DEBUG
 struct timeval lastTimestamp;
 struct timeval tv1, tv2;
 #endif
 
-struct box
+/* what the ML thread hands to the UI loop, a fixed size copy of a Prediction */
+struct ml_result_record
 {
-    uint32_t x, y, w, h;
-    uint32_t num;
-    const char * tag;
+    uint64_t frame_seq;
+    uint64_t timestamp_us;
+    uint32_t count;
+    struct {
+        int16_t x, y, w, h;
+        uint16_t label;
+        float score;
+    } boxes[MAXOBJ];
 };
 
-static struct box result[MAXOBJ];
+/* newest result of the ML thread or the pool's in order callback, taken by the UI loop */
+static LatestValue<ml_result_record> ml_results;
+
+/* class names of the detector, read from the label file by the ML thread */
+static std::vector<std::string> ml_labels;
 
-static const char* labelNames[9] = {
-    "fresh_apple", "normal_apple", "rotten_apple", "fresh_banana", "normal_banana",
-    "rotten_banana", "fresh_orange", "normal_orange", "rotten_orange"
+/* items in the fridge, updated with every result; the home screen shows its summary */
+static std::atomic<Inventory *> ml_inventory(nullptr);
+static lv_obj_t *screen_label_inventory;
+
+/* lines the boxes up with the preview, created by the ML thread */
+static std::atomic<OverlaySync *> ml_overlay(nullptr);
+
+/* copies of the inferred frames, shown with their boxes in hold mode */
+struct held_frame
+{
+    std::atomic<uint64_t> seq;
+    std::vector<uint8_t> bgra;
 };
+static std::vector<std::unique_ptr<held_frame>> ml_held;
+/* the one last handed to the preview, the ML thread copies into the others; -1 for none */
+static std::atomic<int> ml_held_shown(-1);
 
 // lvgl
-lv_img_dsc_t img_preview_desc = {
-    .header = {
-        .cf = LV_IMG_CF_TRUE_COLOR,
-        .always_zero = 0,
-        .reserved = 0,
-        .w = WIDTH,
-        .h = HEIGHT,
-    },
-    .data_size = WIDTH * HEIGHT * 4,
-    .data = NULL,
-};
 lv_ui guider_ui;
 
 typedef struct _V4L2_BufferRecord
@@ -401,58 +443,246 @@ void stream_off(void)
     }
 }
 
-// Add box
-static void canvas_draw_boxes(struct box *boxes, uint32_t count)
+static uint64_t monotonic_us(void)
 {
-    int i;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
 
-    for (i = 0; i < count; i++)
-    {
-        lv_draw_rect_dsc_t rect_dsc;
-        lv_draw_rect_dsc_init(&rect_dsc);
-        rect_dsc.radius = 10;
-        rect_dsc.bg_opa = LV_OPA_TRANSP;
-        rect_dsc.border_width = 10;
-        rect_dsc.border_opa = LV_OPA_100;
-
-        lv_draw_label_dsc_t label_dsc;
-        lv_draw_label_dsc_init(&label_dsc);
-
-        //Green_fresh; Orange_normal; Blue_rotten
-        if (boxes[i].num == 0 || boxes[i].num == 3 || boxes[i].num == 6)
-        {
-            rect_dsc.border_color = lv_palette_main(LV_PALETTE_GREEN);
-            label_dsc.color = lv_palette_main(LV_PALETTE_GREEN);
-        }
-        else if (boxes[i].num == 1 || boxes[i].num == 4 || boxes[i].num == 7)
+/* what the other threads ask the UI loop to do, only the UI loop calls lvgl */
+enum ui_command_type
+{
+    UI_SET_TEXT,            // obj, text
+    UI_SHOW_FRAME,          // slot, seq, ts_us
+    UI_LIGHT_STATE,         // on
+};
+
+struct ui_command
+{
+    uint64_t posted_us;
+    int type;
+    lv_obj_t *obj;
+    int slot;
+    uint64_t seq, ts_us;
+    bool on;
+    char text[160];
+};
+
+/* pushed by any thread, drained by the UI loop before every render */
+static MpscQueue<ui_command, UI_COMMAND_QUEUE_LEN> ui_commands;
+
+/* camera frame on the preview and its capture time; UI loop only */
+static uint64_t ui_frame_seq = UINT64_MAX, ui_frame_ts_us;
+
+static struct
+{
+    uint64_t since_us;
+    uint64_t commands;
+    uint64_t latency_sum_us, latency_max_us;
+} ui_stats;
+
+/* never blocks, false when the UI loop fell that far behind */
+static bool ui_post(ui_command &cmd)
+{
+    cmd.posted_us = monotonic_us();
+    if (!ui_commands.push(cmd))
+        return false;
+    ui_loop_wake();
+    return true;
+}
+
+static void ui_post_text(lv_obj_t *obj, const char *text)
+{
+    ui_command cmd = {};
+    cmd.type = UI_SET_TEXT;
+    cmd.obj = obj;
+    snprintf(cmd.text, sizeof(cmd.text), "%s", text);
+    ui_post(cmd);
+}
+
+static void ui_post_light(bool on)
+{
+    ui_command cmd = {};
+    cmd.type = UI_LIGHT_STATE;
+    cmd.on = on;
+    ui_post(cmd);
+}
+
+/* the camera slot on the preview, -1 when it shows something else */
+static void ui_show_slot(int slot)
+{
+    std::lock_guard<std::mutex> guard(g_src_lock);
+    g_src_shown = slot;
+}
+
+static void ui_run_command(const ui_command &cmd)
+{
+    switch (cmd.type) {
+    case UI_SET_TEXT:
+        lv_label_set_text(cmd.obj, cmd.text);
+        break;
+    case UI_SHOW_FRAME:
         {
-            rect_dsc.border_color = lv_palette_main(LV_PALETTE_ORANGE);
-            label_dsc.color = lv_palette_main(LV_PALETTE_ORANGE);
+            // the camera screen may be gone by now, the slot is then free again
+            std::lock_guard<std::mutex> guard(g_src_lock);
+            g_src_queued[cmd.slot]--;
+            g_src_shown = guider_ui.camera_video ? cmd.slot : -1;
         }
-        else if (boxes[i].num == 2 || boxes[i].num == 5 || boxes[i].num == 8)
-        {
-            rect_dsc.border_color = lv_palette_main(LV_PALETTE_BLUE);
-            label_dsc.color = lv_palette_main(LV_PALETTE_BLUE);
+        if (guider_ui.camera_video)
+            video_view_submit_frame(guider_ui.camera_video, g_src_g2d[cmd.slot]->buf_vaddr, WIDTH, HEIGHT);
+        ui_frame_seq = cmd.seq;
+        ui_frame_ts_us = cmd.ts_us;
+        break;
+    case UI_LIGHT_STATE:
+        events_ui_sync(cmd.on);
+        break;
+    }
+}
+
+static void ui_write_stats(uint64_t now_us)
+{
+    if (now_us - ui_stats.since_us < UI_STATS_PERIOD_US)
+        return;
+
+    ui_loop_wakeups_t wakeups;
+    ui_loop_take_wakeups(&wakeups);
+    FILE *fp = fopen(UI_STATS_PATH, "w");
+    if (fp) {
+        double secs = (now_us - ui_stats.since_us) / 1e6;
+        fprintf(fp, "commands %.1f/s, depth max %zu, latency avg %llu us max %llu us, dropped %llu, "
+                "camera frames dropped %llu\n", ui_stats.commands / secs, ui_commands.take_high_water(),
+                (unsigned long long)(ui_stats.commands ? ui_stats.latency_sum_us / ui_stats.commands : 0),
+                (unsigned long long)ui_stats.latency_max_us, (unsigned long long)ui_commands.dropped(),
+                (unsigned long long)g_src_dropped.load());
+        fprintf(fp, "wakeups %.1f/s: timers %.1f, posts %.1f, input %.1f, display %.1f\n",
+                (wakeups.timer + wakeups.post + wakeups.input + wakeups.display) / secs,
+                wakeups.timer / secs, wakeups.post / secs, wakeups.input / secs, wakeups.display / secs);
+        fclose(fp);
+    }
+    ui_stats = {};
+    ui_stats.since_us = now_us;
+}
+
+/* runs what the other threads posted since the last loop; UI loop only */
+static void ui_drain_commands(void)
+{
+    uint64_t now = monotonic_us();
+    ui_command cmd;
+
+    while (ui_commands.pop(cmd)) {
+        uint64_t latency = now > cmd.posted_us ? now - cmd.posted_us : 0;
+        ui_stats.commands++;
+        ui_stats.latency_sum_us += latency;
+        if (latency > ui_stats.latency_max_us)
+            ui_stats.latency_max_us = latency;
+        ui_run_command(cmd);
+    }
+    ui_write_stats(now);
+}
+
+static void ml_make_record(const Prediction &pred, ml_result_record &rec)
+{
+    rec.frame_seq = pred.frame_seq;
+    rec.timestamp_us = pred.timestamp_us;
+    rec.count = pred.boxes.size() < MAXOBJ ? pred.boxes.size() : MAXOBJ;
+    for (uint32_t i = 0; i < rec.count; i++) {
+        rec.boxes[i].x = pred.boxes[i].x;
+        rec.boxes[i].y = pred.boxes[i].y;
+        rec.boxes[i].w = pred.boxes[i].width;
+        rec.boxes[i].h = pred.boxes[i].height;
+        rec.boxes[i].label = pred.labels[i];
+        rec.boxes[i].score = pred.scores[i];
+    }
+}
+
+/* box color of a class: Green_fresh; Orange_normal; Blue_rotten */
+static lv_color_t ml_box_color(int label)
+{
+    if (label == 0 || label == 3 || label == 6)
+        return lv_palette_main(LV_PALETTE_GREEN);
+    if (label == 1 || label == 4 || label == 7)
+        return lv_palette_main(LV_PALETTE_ORANGE);
+    if (label == 2 || label == 5 || label == 8)
+        return lv_palette_main(LV_PALETTE_BLUE);
+    return lv_color_white();
+}
+
+/* replace the boxes of the overlay, UI loop only; it only invalidates what changed */
+static void ml_draw_record(const ml_result_record &rec)
+{
+    box_overlay_item_t items[MAXOBJ];
+
+    if (!guider_ui.camera_box_overlay)
+        return;
+    memset(items, 0, sizeof(items));
+    for (uint32_t i = 0; i < rec.count; i++) {
+        int label = rec.boxes[i].label;
+
+        items[i].x = rec.boxes[i].x;
+        items[i].y = rec.boxes[i].y;
+        items[i].w = rec.boxes[i].w;
+        items[i].h = rec.boxes[i].h;
+        items[i].color = ml_box_color(label);
+        items[i].text = label < (int)ml_labels.size() ? ml_labels[label].c_str() : "?";
+    }
+    box_overlay_set_boxes(guider_ui.camera_box_overlay, items, rec.count);
+}
+
+/* results of the ML thread onto the screen, called by the UI loop after the commands */
+static void ml_ui_update(void)
+{
+    static uint64_t compensated_seq = UINT64_MAX;
+    ml_result_record rec;
+    // only the newest, older ones would only be overdrawn
+    bool fresh = ml_results.take(rec);
+
+    OverlaySync *overlay = ml_overlay.load();
+    if (!overlay)
+        return;
+    int mode = overlay->mode();
+
+    // boxes moved to every new camera frame
+    if (mode == OVERLAY_COMPENSATE) {
+        Prediction moved;
+        if (ui_frame_seq != compensated_seq && overlay->predict(ui_frame_ts_us, moved)) {
+            ml_make_record(moved, rec);
+            ml_draw_record(rec);
+            compensated_seq = ui_frame_seq;
         }
-        else
-        {
-            rect_dsc.border_color = lv_color_white();
-            label_dsc.color = lv_color_white();
+        return;
+    }
+    if (!fresh)
+        return;
+
+    if (mode == OVERLAY_HOLD && guider_ui.camera_video) {
+        for (size_t i = 0; i < ml_held.size(); i++) {
+            held_frame *frame = ml_held[i].get();
+            if (frame->seq == rec.frame_seq) {
+                ml_held_shown = i;
+                video_view_submit_frame(guider_ui.camera_video, frame->bgra.data(), WIDTH, HEIGHT);
+                ui_show_slot(-1);
+                break;
+            }
         }
+    }
+    ml_draw_record(rec);
+}
 
-        lv_canvas_draw_rect(guider_ui.camera_canvas_boxes,
-            boxes[i].x,
-            boxes[i].y,
-            boxes[i].w,
-            boxes[i].h,
-            &rect_dsc);
-        lv_canvas_draw_text(guider_ui.camera_canvas_boxes,
-            boxes[i].x + 2*rect_dsc.border_width,
-            boxes[i].y + 2*rect_dsc.border_width,
-            boxes[i].w * 2,
-            &label_dsc,
-            boxes[i].tag);
+/*
+ * A slot no other thread uses: not the latest frame (the ML thread may take
+ * it any time), not the one it reads, not the one on the preview and none
+ * still queued for the preview. -1 when the UI loop or the ML thread hold
+ * them all, the frame is then dropped.
+ */
+static int camera_free_slot(void)
+{
+    std::lock_guard<std::mutex> guard(g_src_lock);
+    for (int i = 0; i < CAMERA_SLOTS; i++) {
+        if (i != g_src_latest && i != g_src_ml && i != g_src_shown && !g_src_queued[i])
+            return i;
     }
+    return -1;
 }
 
 void *cam_thread_func(void *)
@@ -468,6 +698,7 @@ void *cam_thread_func(void *)
     for (;;)
     {
         int res;
+        uint64_t ts_us;
         struct v4l2_plane planes;
         CLEAR(vbuffer);
         CLEAR(planes);
@@ -483,6 +714,7 @@ void *cam_thread_func(void *)
             printf("exit camera thread finish******************\n");
             return NULL;
         }
+        ts_us = monotonic_us();
 
 #ifdef DEBUG
         if (frame_cnt % 30 == 0)
@@ -495,16 +727,38 @@ void *cam_thread_func(void *)
         }
 #endif
 
-        // CSC
-        if (g_ui_camera) {
+        // CSC, straight into a slot no other thread reads, dropped when there is none
+        int slot = g_ui_camera ? camera_free_slot() : -1;
+        if (g_ui_camera && slot < 0)
+            g_src_dropped++;
+        if (slot >= 0) {
             memcpy(g_sbuf->buf_vaddr, (uint8_t *)v4l2_buffer_record[vbuffer.index].mStart, WIDTH * HEIGHT * 2);
-            yuyv2bgr(g_sbuf, g_dbuf, WIDTH, HEIGHT, handle);
-            // aquire write lock to fill g_src_buf
-            pthread_rwlock_wrlock(&rwlock);
-            memcpy(g_src_buf, (uint8_t *)g_dbuf->buf_vaddr, WIDTH * HEIGHT * 4);
-            img_preview_desc.data = (uint8_t *)g_src_buf;
-            lv_img_set_src(guider_ui.camera_img_display, &img_preview_desc);
-            pthread_rwlock_unlock(&rwlock);
+            yuyv2bgr(g_sbuf, g_src_g2d[slot], WIDTH, HEIGHT, handle);
+            // the CPU only reads the slots, dropping its stale lines is enough
+            g2d_cache_op(g_src_g2d[slot], G2D_CACHE_INVALIDATE);
+
+            // in hold mode the preview only changes with the results
+            OverlaySync *overlay = ml_overlay.load();
+            bool preview = !overlay || overlay->mode() != OVERLAY_HOLD;
+            {
+                std::lock_guard<std::mutex> guard(g_src_lock);
+                g_src_latest = slot;
+                g_src_seq = frame_cnt;
+                g_src_ts_us = ts_us;
+                if (preview)
+                    g_src_queued[slot]++;
+            }
+            if (preview) {
+                ui_command cmd = {};
+                cmd.type = UI_SHOW_FRAME;
+                cmd.slot = slot;
+                cmd.seq = frame_cnt;
+                cmd.ts_us = ts_us;
+                if (!ui_post(cmd)) {
+                    std::lock_guard<std::mutex> guard(g_src_lock);
+                    g_src_queued[slot]--;
+                }
+            }
 
             if (frame_cnt % 3 == 0)
                 pthread_cond_signal(&ml_cond);
@@ -523,53 +777,290 @@ void *cam_thread_func(void *)
     return NULL;
 }
 
+static volatile sig_atomic_t ml_profile_dump = 0;
+
+static void ml_profile_sig_handler(int signum)
+{
+    ml_profile_dump = 1;
+}
+
+static void ml_write_profile(ModelReloader &models, uint64_t inferences)
+{
+    bool requested = ml_profile_dump;
+
+    if (!models.get()->profiling())
+        return;
+    if (!requested && (inferences == 0 || inferences % ML_PROFILE_PERIOD != 0))
+        return;
+    ml_profile_dump = 0;
+
+    FILE *fp = fopen(ML_PROFILE_PATH, "w");
+    for (int i = 0; i < models.slots(); i++) {
+        std::string summary = models.get(i)->profile_summary();
+        if (fp)
+            fprintf(fp, "worker %d: %s\n", i, summary.c_str());
+        if (requested)
+            printf("ML profile, worker %d: %s\n", i, summary.c_str());
+    }
+    if (fp)
+        fclose(fp);
+}
+
+static void ml_write_roi_stats(RoiScheduler &rois, uint64_t inferences)
+{
+    if (inferences % ML_ROI_STATS_PERIOD != 0)
+        return;
+
+    FILE *fp = fopen(ML_ROI_STATS_PATH, "w");
+    if (!fp)
+        return;
+    fprintf(fp, "%s", rois.stats().c_str());
+    fclose(fp);
+}
+
+/* items with the age of the oldest of each class, rewritten when the inventory changes */
+static void ml_write_inventory(const Inventory &inventory)
+{
+    FILE *fp = fopen(ML_INVENTORY_PATH, "w");
+    if (!fp)
+        return;
+    fprintf(fp, "%s", inventory.describe(ml_labels).c_str());
+    fclose(fp);
+}
+
+/* never blocks on the UI, a record the UI loop did not take yet is replaced */
+static void ml_publish_result(const Prediction &pred)
+{
+    ml_result_record rec;
+
+    ml_overlay.load()->published(pred, monotonic_us());
+    ml_make_record(pred, rec);
+    ml_results.publish(rec);
+    ui_loop_wake();
+
+    Inventory *inventory = ml_inventory.load();
+    if (inventory && inventory->update(pred)) {
+        ui_post_text(screen_label_inventory, inventory->summary(ml_labels).c_str());
+        ml_write_inventory(*inventory);
+    }
+}
+
 void *ml_thread_func(void *)
 {
-    YOLOV4 model("/usr/share/ml_model/yolov4-tiny-freshness-vela.tflite", 2, 2);
+    /* SIGINT is handled on another thread, which saves the inventory once an update here is done */
+    sigset_t sigint;
+    sigemptyset(&sigint);
+    sigaddset(&sigint, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &sigint, nullptr);
+
+    MLConfig ml_config;
+    if (!load_ml_config(ML_CONFIG_PATH, ml_config))
+        printf("No %s, using default ML config\n", ML_CONFIG_PATH);
+    printf("ML model %s, delegate %s, %d threads, %d workers\n", ml_config.model_path.c_str(),
+            ml_delegate_name(ml_config.delegate), ml_config.num_threads, ml_config.num_workers);
+
+    /* the tracker of the two stage pipeline needs the frames in order on one thread */
+    if (!ml_config.classifier_path.empty() && ml_config.num_workers > 1) {
+        printf("workers = %d ignored with a classifier\n", ml_config.num_workers);
+        ml_config.num_workers = 1;
+    }
+
+    /* replacing the model file swaps the interpreter without restarting */
+    ModelReloader models(ml_config.model_path, ml_config.delegate, ml_config.num_threads,
+            ml_config.num_workers);
+    models.start();
+
+    for (int i = 0; i < models.slots(); i++)
+        models.get(i)->box_format = (BoxFormat)ml_config.box_format;
+
+    /* with a classifier the detector only finds the fruit, the labels are the classifier's */
+    std::unique_ptr<TwoStageDetector> two_stage;
+    int num_classes = models.get()->num_classes();
+    if (!ml_config.classifier_path.empty()) {
+        two_stage.reset(new TwoStageDetector(ml_config.classifier_path, ml_config.delegate,
+                ml_config.num_threads, ml_config.budget_ms));
+        num_classes = two_stage->num_classes();
+        printf("ML classifier %s, budget %.1f ms\n", ml_config.classifier_path.c_str(), ml_config.budget_ms);
+    }
+    models.get()->getLabelsName(ml_config.labels_path, ml_labels);
+    for (int i = 1; i < models.slots(); i++)
+        models.get(i)->set_labels(ml_labels);
+    if ((int)ml_labels.size() != num_classes)
+        printf("%zu labels for %d classes in %s\n", ml_labels.size(), num_classes, ml_config.labels_path.c_str());
+
+    /* full frame now and then, the regions with activity in between */
+    std::unique_ptr<RoiScheduler> rois;
+    if (ml_config.full_frame_period > 0) {
+        if (models.slots() > 1 || two_stage) {
+            printf("full_frame_period ignored with workers or a classifier\n");
+        } else {
+            rois.reset(new RoiScheduler(WIDTH, HEIGHT, ml_config.full_frame_period, ml_config.roi_size));
+            for (const MLRoi &roi : ml_config.rois)
+                rois->add_roi(cv::Rect(roi.x, roi.y, roi.w, roi.h));
+            printf("ML regions: full frame every %d inferences, %zu configured, stats in %s\n",
+                    ml_config.full_frame_period, ml_config.rois.size(), ML_ROI_STATS_PATH);
+        }
+    }
+
+    /* G2D converts and scales the frame straight into the detector input */
+    std::unique_ptr<G2DInput> g2d_input;
+    if (ml_config.g2d_input && models.slots() == 1 && !two_stage && !rois) {
+        g2d_input.reset(new G2DInput);
+        if (!g2d_input->open())
+            g2d_input.reset();
+    }
+    printf("ML input from %s\n", g2d_input ? "G2D" : "the CPU");
+
+    /* the last inventory is on the home screen before the first result */
+    std::unique_ptr<Inventory> inventory;
+    if (!ml_config.inventory_path.empty()) {
+        inventory.reset(new Inventory(ml_config.inventory_path, num_classes));
+        bool restored = inventory->load();
+        ui_post_text(screen_label_inventory, inventory->summary(ml_labels).c_str());
+        printf("Inventory %s %s\n", restored ? "restored from" : "starts empty, saved to",
+                ml_config.inventory_path.c_str());
+        ml_inventory.store(inventory.get());
+    }
+
+    /* history of the items seen, with thumbnails */
+    std::unique_ptr<DetectionJournal> journal;
+    if (!ml_config.journal_dir.empty()) {
+        if (models.slots() > 1) {
+            printf("journal ignored with workers\n");
+        } else {
+            journal.reset(new DetectionJournal(ml_config.journal_dir));
+            if (journal->open())
+                printf("ML journal in %s, %llu events\n", ml_config.journal_dir.c_str(),
+                        (unsigned long long)journal->events());
+            else
+                journal.reset();
+        }
+    }
+
+    /* the preview is held on the inferred frames or the boxes moved to the live one */
+    OverlaySync overlay(ml_config.overlay, ml_config.hold_budget_ms, ml_config.compensate_budget_ms);
+    if (ml_config.overlay == OVERLAY_HOLD || ml_config.overlay == OVERLAY_AUTO) {
+        // one per frame in flight, plus the one shown and the one being copied
+        for (int i = 0; i < models.slots() + 2; i++) {
+            std::unique_ptr<held_frame> frame(new held_frame);
+            frame->seq = UINT64_MAX;
+            frame->bgra.resize(WIDTH * HEIGHT * 4);
+            ml_held.push_back(std::move(frame));
+        }
+    }
+    ml_overlay.store(&overlay);
+    printf("ML overlay %s\n", overlay_mode_name(ml_config.overlay));
+
+    if (ml_config.profile) {
+        for (int i = 0; i < models.slots(); i++)
+            models.get(i)->set_profiling(true);
+        signal(SIGUSR1, ml_profile_sig_handler);
+        printf("ML profiling on, kill -USR1 %d to dump it, summary in %s\n", getpid(), ML_PROFILE_PATH);
+    }
+
+    /* with several workers consecutive frames are pipelined over the cores */
+    std::unique_ptr<InferencePool> pool;
+    uint64_t delivered = 0;
+    if (models.slots() > 1) {
+        pool.reset(new InferencePool(models, [&models, &delivered](InferenceResult &res) {
+            ml_publish_result(res.pred);
+            ml_write_profile(models, ++delivered);
+        }));
+        pool->start();
+    }
+
     Prediction out_pred;
     cv::Mat rgb_frame;
-    int obj_size, status;
+    uint64_t inferences = 0;
+    size_t held_next = 0;
+    int status;
 
     while (1) {
         pthread_mutex_lock(&mutex_ml);
         status = pthread_cond_wait(&ml_cond, &mutex_ml);
         pthread_mutex_unlock(&mutex_ml);
         if (status == 0) {
-            cv::Mat bgra_frame(HEIGHT, WIDTH, CV_8UC4, g_src_buf);
-            cv::cvtColor(bgra_frame, rgb_frame, cv::COLOR_BGRA2RGB);
-            // aquire read lock for g_src_buf
-            pthread_rwlock_rdlock(&rwlock);
-            model.run(rgb_frame, out_pred);
-            pthread_rwlock_unlock(&rwlock);
-
-            // draw result
-            auto boxes = out_pred.boxes;
-            auto labels = out_pred.labels;
-
-            if (boxes.size() >= MAXOBJ)
-                obj_size = MAXOBJ;
-            else
-                obj_size = boxes.size();
-
-            for (int i = 0; i < obj_size; i++) {
-                auto box = boxes[i];
-                // auto score = scores[i];
-                auto label = labels[i];
-
-                result[i].x = box.x;
-                result[i].y = box.y;
-                result[i].w = box.width;
-                result[i].h = box.height;
-                result[i].num = label;
-                result[i].tag = labelNames[label];
+            // the camera does not write the latest slot while it is taken
+            int slot;
+            uint64_t seq, ts_us;
+            {
+                std::lock_guard<std::mutex> guard(g_src_lock);
+                slot = g_src_latest;
+                seq = g_src_seq;
+                ts_us = g_src_ts_us;
+                g_src_ml = slot;
+            }
+            if (slot < 0)
+                continue;
+            uint8_t *src_buf = (uint8_t *)g_src_g2d[slot]->buf_vaddr;
+
+            std::shared_ptr<YOLOV4> model = models.get();
+            int frame_copies = 0;
+            bool converted = false;
+            if (g2d_input)
+                converted = g2d_input->convert(*model, g_src_g2d[slot], WIDTH, HEIGHT);
+            // the journal crops its thumbnails from the converted frame, the slot is kept until then
+            bool journal_slot = converted && journal;
+            if (!converted) {
+                cv::Mat bgra_frame(HEIGHT, WIDTH, CV_8UC4, src_buf);
+                cv::cvtColor(bgra_frame, rgb_frame, cv::COLOR_BGRA2RGB);
+                frame_copies++;
+            }
+            // kept to be shown with its boxes, the slot is not the one on screen
+            held_frame *held = nullptr;
+            if (!ml_held.empty() && overlay.mode() == OVERLAY_HOLD) {
+                // never the one the UI may be drawing, and matched by no result while it is copied
+                if ((int)held_next == ml_held_shown)
+                    held_next = (held_next + 1) % ml_held.size();
+                held = ml_held[held_next].get();
+                held->seq = UINT64_MAX;
+                memcpy(held->bgra.data(), src_buf, WIDTH * HEIGHT * 4);
+                held->seq = seq;
+                frame_copies++;
+            }
+            if (!journal_slot) {
+                std::lock_guard<std::mutex> guard(g_src_lock);
+                g_src_ml = -1;
             }
 
-            // aquire write lock to avoid rendering
-            pthread_rwlock_wrlock(&rwlock);
-            lv_canvas_fill_bg(guider_ui.camera_canvas_boxes, lv_color_hex(0xffffff), 0);
-            canvas_draw_boxes(result, obj_size);
-            pthread_rwlock_unlock(&rwlock);
-            out_pred = {};
+            if (pool) {
+                // dropped when the next worker is still busy
+                if (!pool->submit(rgb_frame, seq, ts_us))
+                    held = nullptr;
+            } else {
+                // counted with the inference, the pool's workers run their own models
+                model->count_frame_copies(frame_copies);
+                if (two_stage) {
+                    two_stage->run(*model, rgb_frame, out_pred);
+                } else if (rois) {
+                    // the crop is a view, the detector pads and resizes it like a frame
+                    int roi_index;
+                    Prediction roi_pred;
+                    cv::Rect region = rois->plan(rgb_frame, roi_index);
+                    model->run(rgb_frame(region), roi_pred);
+                    rois->report(roi_index, region, roi_pred, out_pred);
+                } else if (converted) {
+                    model->run_prepared(WIDTH, HEIGHT, out_pred, g2d_input->convert_ms());
+                } else {
+                    model->run(rgb_frame, out_pred);
+                }
+                out_pred.frame_seq = seq;
+                out_pred.timestamp_us = ts_us;
+                ml_publish_result(out_pred);
+                if (journal_slot) {
+                    journal->record(out_pred, cv::Mat(HEIGHT, WIDTH, CV_8UC4, src_buf));
+                    std::lock_guard<std::mutex> guard(g_src_lock);
+                    g_src_ml = -1;
+                } else if (journal) {
+                    journal->record(out_pred, rgb_frame);
+                }
+                out_pred = {};
+                ml_write_profile(models, ++inferences);
+                if (rois)
+                    ml_write_roi_stats(*rois, inferences);
+            }
+            if (held)
+                held_next = (held_next + 1) % ml_held.size();
         }
     }
 
@@ -582,8 +1073,12 @@ void sig_handler(int signum)
     printf("\nInside Signal handler function\n");
     printf("------SIGINT signal catched------\n");
     printf("Program exit...\n");
+    /* the changes since the last periodic save */
+    Inventory *inventory = ml_inventory.load();
+    if (inventory)
+        inventory->flush();
     lv_deinit();
-    drm_exit();
+    drm_display_exit();
     exit(0);
 }
 
@@ -597,10 +1092,8 @@ static void update_datetime(void)
     tmp = localtime(&t);
     strftime(cur_date, sizeof(cur_date), "\n%A, %b %d", tmp);
     strftime(cur_time, sizeof(cur_time), "%H:%M", tmp);
-    pthread_rwlock_wrlock(&rwlock);
-    lv_label_set_text(guider_ui.screen_label_Date, cur_date);
-    lv_label_set_text(guider_ui.screen_label_Time, cur_time);
-    pthread_rwlock_unlock(&rwlock);
+    ui_post_text(guider_ui.screen_label_Date, cur_date);
+    ui_post_text(guider_ui.screen_label_Time, cur_time);
 }
 
 static void get_weather_report()
@@ -646,9 +1139,7 @@ static void get_weather_report()
     }
 
     /* update label text */
-    pthread_rwlock_wrlock(&rwlock);
-    lv_label_set_text(guider_ui.screen_label_weather, buf);
-    pthread_rwlock_unlock(&rwlock);
+    ui_post_text(guider_ui.screen_label_weather, buf);
 }
 
 void *weather_thread_func(void *)
@@ -700,7 +1191,7 @@ void *matter_thread_func(void *)
     light_ctl_flag = Bulb_status;
     matter_handle = fd;
 
-    events_ui_sync(light_ctl_flag);
+    ui_post_light(light_ctl_flag);
 
     /* read temperature sensor data */
     while(1) {
@@ -708,9 +1199,7 @@ void *matter_thread_func(void *)
                         8888 3 --storage-directory /usr/share/matter", buf);
 
         /* update label text */
-        pthread_rwlock_wrlock(&rwlock);
-        lv_label_set_text(guider_ui.screen_btn_temp_label, buf);
-        pthread_rwlock_unlock(&rwlock);
+        ui_post_text(guider_ui.screen_btn_temp_label, buf);
         sleep(15);
     }
 
@@ -750,13 +1239,13 @@ void *receiveMessage(void *)
         if (strcmp(recvbuf.mtext,"TURN ON LIGHT") == 0) {
             input_cmd("onoff on 1234 1", matter_handle);
             light_ctl_flag = true;
-            events_ui_sync(light_ctl_flag);
+            ui_post_light(light_ctl_flag);
             printf("Received TURN ON LIGHT\n");
         }
         else if (strcmp(recvbuf.mtext,"TURN OFF LIGHT") == 0) {
             input_cmd("onoff off 1234 1", matter_handle);
             light_ctl_flag = false;
-            events_ui_sync(light_ctl_flag);
+            ui_post_light(light_ctl_flag);
             printf("Received TURN OFF LIGHT\n");
         }
         else if (strcmp(recvbuf.mtext,"STANDBY") == 0) {
@@ -774,8 +1263,6 @@ void *receiveMessage(void *)
 
 int main(void)
 {
-    static lv_color_t buf[DISP_BUF_SIZE];
-    static lv_disp_draw_buf_t disp_buf;
     static lv_disp_t *disp;
     static lv_disp_drv_t disp_drv;
     static lv_indev_drv_t indev_drv;
@@ -786,19 +1273,12 @@ int main(void)
 
     lv_init();
 
-    /*DRM init*/
-    drm_init();
-
-    /*Initialize a descriptor for the buffer*/
-    lv_disp_draw_buf_init(&disp_buf, buf, NULL, DISP_BUF_SIZE);
-
-    /*Initialize and register a display driver*/
+    /*Initialize and register a double buffered DRM display*/
     lv_disp_drv_init(&disp_drv);
-    disp_drv.draw_buf = &disp_buf;
-    disp_drv.flush_cb = drm_flush;
-    /* Screen Size */
-    disp_drv.hor_res = H_RES;
-    disp_drv.ver_res = V_RES;
+    if (drm_display_init(&disp_drv)) {
+        printf("No display!\n");
+        return -1;
+    }
     disp = lv_disp_drv_register(&disp_drv);
 
     /* Initialize and register a display input driver */
@@ -809,13 +1289,24 @@ int main(void)
     indev_drv.read_cb = evdev_read;
     lv_indev_t *my_indev = lv_indev_drv_register(&indev_drv);
 
+    /* before the threads, they wake the UI loop up */
+    if (ui_loop_init(my_indev))
+        return -1;
+
     /* Set Image Cache size */
     lv_img_cache_set_size(10);
 
+#ifdef ASSET_PACK
+    /* the screens are drawn without their images when it is missing */
+    if (asset_pack_open(ASSET_PACK_PATH))
+        printf("No images for the screens!\n");
+#endif
+
     /* Demo init */
     setup_ui(&guider_ui);
     events_init(&guider_ui);
     custom_init(&guider_ui);
+    screen_label_inventory = inventory_label_create(&guider_ui);
 
     /* show GUI first */
     lv_task_handler();
@@ -824,8 +1315,9 @@ int main(void)
     if (0 == camera_init()) {
         /* allocate buffer for G2D and rendering */
         g_sbuf = g2d_alloc(WIDTH * HEIGHT * 4, 0);
-        g_dbuf = g2d_alloc(WIDTH * HEIGHT * 4, 0);
-        g_src_buf = (uint8_t *)malloc(WIDTH * HEIGHT * 4);
+        /* cacheable, the CPU reads them for the preview, the ML input and the held frames */
+        for (int i = 0; i < CAMERA_SLOTS; i++)
+            g_src_g2d[i] = g2d_alloc(WIDTH * HEIGHT * 4, 1);
         /* create threads for camera q/dq and ML inference */
         pthread_create(&video_thread, NULL, cam_thread_func, NULL);
         pthread_create(&inference_thread, NULL, ml_thread_func, NULL);
@@ -835,6 +1327,7 @@ int main(void)
 
     /* Linux input device init */
     evdev_init();
+    ui_loop_watch_input(evdev_fd);
 
     /**
      * Create thread to get weather report.
@@ -857,16 +1350,19 @@ int main(void)
 #ifdef DEBUG
         gettimeofday(&tv1, NULL);
 #endif
-        /* aquire read lock, since rendering only need read consume */
-        pthread_rwlock_rdlock(&rwlock);
-        lv_task_handler();
-        pthread_rwlock_unlock(&rwlock);
+        /* the other threads only post commands, lvgl is never locked */
+        ui_drain_commands();
+        ml_ui_update();
+        if (guider_ui.camera_video)
+            video_view_refresh(guider_ui.camera_video);
+        uint32_t next_ms = ui_loop_run_timers();
 #ifdef DEBUG
         gettimeofday(&tv2, NULL);
         int time_handler = (tv2.tv_sec * 1000 + tv2.tv_usec / (1000)) - (tv1.tv_sec * 1000 + tv1.tv_usec / (1000));
         printf("lv_task_handler tasks:%d ms\n", time_handler);
 #endif
-        usleep(LVGL_REFRESH_DELAY_US);
+        /* asleep until a timer, a post, a touch or the page flip of the frame just drawn */
+        ui_loop_wait(next_ms);
     }
 
     return 0;
@@ -0,0 +1,398 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "detection_journal.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define JOURNAL_MAGIC 0x4e524a46    // "FJRN"
+#define JOURNAL_VERSION 1
+// events per file, 2 MB of records
+#define JOURNAL_CAPACITY 65536
+// events between two checkpoints of the index
+#define JOURNAL_CHECKPOINT 256
+// thumbnail files reused in a ring
+#define JOURNAL_THUMB_SLOTS 512
+// snapshots waiting for the writer before new ones are dropped
+#define JOURNAL_QUEUE_LEN 8
+// longest side of a thumbnail
+#define JOURNAL_THUMB_SIZE 96
+#define JOURNAL_JPEG_QUALITY 80
+
+struct DetectionJournal::Header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t capacity;
+    uint64_t count;             // committed records, written after the record itself
+    uint8_t reserved[40];
+};
+
+static_assert(sizeof(JournalEvent) == 32, "journal records are 32 bytes");
+
+static uint64_t clock_us(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+DetectionJournal::DetectionJournal(const std::string &dir) : dir_(dir)
+{
+}
+
+DetectionJournal::~DetectionJournal()
+{
+    if (writer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(queue_lock_);
+            stop_ = true;
+        }
+        queue_cond_.notify_one();
+        writer_.join();
+    }
+    unmap_file();
+}
+
+std::string DetectionJournal::thumb_path(uint16_t slot) const
+{
+    return dir_ + "/thumbs/" + std::to_string(slot) + ".jpg";
+}
+
+bool DetectionJournal::map_file(const std::string &path)
+{
+    map_size_ = sizeof(Header) + (size_t)JOURNAL_CAPACITY * sizeof(JournalEvent);
+
+    fd_ = ::open(path.c_str(), read_only_ ? O_RDONLY : (O_RDWR | O_CREAT), 0644);
+    if (fd_ < 0) {
+        printf("Cannot open journal %s \n", path.c_str());
+        return false;
+    }
+    struct stat st;
+    fstat(fd_, &st);
+    bool fresh = st.st_size == 0;
+    if (fresh && read_only_) {
+        printf("Journal %s is empty \n", path.c_str());
+        unmap_file();
+        return false;
+    }
+    if (fresh && ftruncate(fd_, map_size_) != 0) {
+        printf("Cannot size journal %s \n", path.c_str());
+        unmap_file();
+        return false;
+    }
+    if (!fresh && (size_t)st.st_size != map_size_) {
+        printf("Journal %s has an unexpected size \n", path.c_str());
+        unmap_file();
+        return false;
+    }
+
+    void *map = mmap(nullptr, map_size_, read_only_ ? PROT_READ : (PROT_READ | PROT_WRITE), MAP_SHARED, fd_, 0);
+    if (map == MAP_FAILED) {
+        printf("Cannot map journal %s \n", path.c_str());
+        unmap_file();
+        return false;
+    }
+    header_ = (Header *)map;
+    events_ = (JournalEvent *)((uint8_t *)map + sizeof(Header));
+
+    if (fresh) {
+        header_->magic = JOURNAL_MAGIC;
+        header_->version = JOURNAL_VERSION;
+        header_->record_size = sizeof(JournalEvent);
+        header_->capacity = JOURNAL_CAPACITY;
+        header_->count = 0;
+    } else if (header_->magic != JOURNAL_MAGIC || header_->version != JOURNAL_VERSION ||
+               header_->record_size != sizeof(JournalEvent) || header_->capacity != JOURNAL_CAPACITY) {
+        printf("Journal %s has another format \n", path.c_str());
+        unmap_file();
+        return false;
+    }
+    return true;
+}
+
+void DetectionJournal::unmap_file()
+{
+    if (header_)
+        munmap(header_, map_size_);
+    if (fd_ >= 0)
+        close(fd_);
+    header_ = nullptr;
+    events_ = nullptr;
+    fd_ = -1;
+}
+
+bool DetectionJournal::open(bool read_only, const char *file)
+{
+    read_only_ = read_only;
+    if (!read_only) {
+        mkdir(dir_.c_str(), 0755);
+        mkdir((dir_ + "/thumbs").c_str(), 0755);
+    }
+    if (!map_file(dir_ + "/" + file))
+        return false;
+
+    std::lock_guard<std::mutex> guard(lock_);
+    rebuild_index();
+    if (read_only)
+        return true;
+
+    // tracks do not survive a restart, whatever was present is closed now
+    uint64_t now = std::max(clock_us(CLOCK_REALTIME), last_time_us_);
+    std::vector<JournalItem> open_items;
+    for (auto &it : live_)
+        open_items.push_back(it.second);
+    for (const JournalItem &item : open_items) {
+        JournalEvent ev = {};
+        ev.time_us = now;
+        ev.track = item.track;
+        ev.label = item.label;
+        ev.kind = JOURNAL_GONE;
+        ev.thumb = JOURNAL_NO_THUMB;
+        append(ev);
+    }
+
+    writer_ = std::thread(&DetectionJournal::writer_loop, this);
+    return true;
+}
+
+void DetectionJournal::apply(const JournalEvent &ev, std::map<uint32_t, JournalItem> &items)
+{
+    if (ev.kind == JOURNAL_GONE) {
+        items.erase(ev.track);
+        return;
+    }
+    JournalItem &item = items[ev.track];
+    if (ev.kind == JOURNAL_APPEAR || item.since_us == 0)
+        item.since_us = ev.time_us;
+    item.track = ev.track;
+    item.label = ev.label;
+    item.score = ev.score;
+    item.box = cv::Rect(ev.x, ev.y, ev.w, ev.h);
+    if (ev.thumb != JOURNAL_NO_THUMB || ev.kind == JOURNAL_APPEAR)
+        item.thumb = ev.thumb;
+}
+
+void DetectionJournal::rebuild_index()
+{
+    uint64_t count = std::min<uint64_t>(__atomic_load_n(&header_->count, __ATOMIC_ACQUIRE), JOURNAL_CAPACITY);
+
+    live_.clear();
+    index_.clear();
+    index_.push_back({0, 0, {}});
+    last_time_us_ = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        const JournalEvent &ev = events_[i];
+        apply(ev, live_);
+        last_time_us_ = ev.time_us;
+        if (ev.thumb != JOURNAL_NO_THUMB)
+            next_thumb_ = (ev.thumb + 1) % JOURNAL_THUMB_SLOTS;
+        if ((i + 1) % JOURNAL_CHECKPOINT == 0)
+            index_.push_back({i + 1, ev.time_us, live_});
+    }
+}
+
+void DetectionJournal::rotate()
+{
+    // the full file is kept as the previous one, the new one starts with what is present
+    unmap_file();
+    std::string path = dir_ + "/" JOURNAL_FILE;
+    rename(path.c_str(), (dir_ + "/" JOURNAL_PREVIOUS_FILE).c_str());
+    if (!map_file(path)) {
+        printf("Journal stopped \n");
+        return;
+    }
+
+    std::map<uint32_t, JournalItem> present = live_;
+    live_.clear();
+    index_.clear();
+    index_.push_back({0, 0, {}});
+    for (auto &it : present) {
+        const JournalItem &item = it.second;
+        JournalEvent ev = {};
+        ev.time_us = last_time_us_;
+        ev.track = item.track;
+        ev.label = item.label;
+        ev.kind = JOURNAL_APPEAR;
+        ev.score = item.score;
+        ev.x = item.box.x;
+        ev.y = item.box.y;
+        ev.w = item.box.width;
+        ev.h = item.box.height;
+        ev.thumb = item.thumb;
+        append(ev);
+    }
+}
+
+void DetectionJournal::append(JournalEvent ev)
+{
+    if (!header_)
+        return;
+    uint64_t count = header_->count;
+    if (count >= JOURNAL_CAPACITY) {
+        rotate();
+        if (!header_)
+            return;
+        count = header_->count;
+    }
+
+    // the record first, then the count, a crash in between loses only this event
+    events_[count] = ev;
+    __atomic_store_n(&header_->count, count + 1, __ATOMIC_RELEASE);
+
+    apply(ev, live_);
+    last_time_us_ = ev.time_us;
+    if ((count + 1) % JOURNAL_CHECKPOINT == 0)
+        index_.push_back({count + 1, ev.time_us, live_});
+}
+
+void DetectionJournal::snapshot(const cv::Rect &box, const cv::Mat &frame, JournalEvent &ev)
+{
+    ev.thumb = JOURNAL_NO_THUMB;
+    cv::Rect roi = box & cv::Rect(0, 0, frame.cols, frame.rows);
+    if (roi.empty())
+        return;
+
+    std::lock_guard<std::mutex> guard(queue_lock_);
+    if (queue_.size() >= JOURNAL_QUEUE_LEN) {
+        dropped_++;
+        return;
+    }
+    // only the small crop is made here, the encoding is the writer's
+    double scale = std::min(1.0, (double)JOURNAL_THUMB_SIZE / std::max(roi.width, roi.height));
+    Snapshot snap;
+    cv::resize(frame(roi), snap.crop, cv::Size(), scale, scale, cv::INTER_AREA);
+    if (snap.crop.channels() == 4)
+        cv::cvtColor(snap.crop, snap.crop, cv::COLOR_BGRA2RGB);
+    snap.slot = next_thumb_;
+    next_thumb_ = (next_thumb_ + 1) % JOURNAL_THUMB_SLOTS;
+    queue_.push_back(snap);
+    ev.thumb = snap.slot;
+    queue_cond_.notify_one();
+}
+
+void DetectionJournal::writer_loop()
+{
+    std::vector<int> params = {cv::IMWRITE_JPEG_QUALITY, JOURNAL_JPEG_QUALITY};
+    while (1) {
+        Snapshot snap;
+        {
+            std::unique_lock<std::mutex> guard(queue_lock_);
+            queue_cond_.wait(guard, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty())
+                return;
+            snap = queue_.front();
+            queue_.pop_front();
+        }
+        cv::Mat bgr;
+        cv::cvtColor(snap.crop, bgr, cv::COLOR_RGB2BGR);
+        if (!cv::imwrite(thumb_path(snap.slot), bgr, params))
+            printf("Cannot write %s \n", thumb_path(snap.slot).c_str());
+    }
+}
+
+void DetectionJournal::record(const Prediction &pred, const cv::Mat &frame)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!header_ || read_only_)
+        return;
+
+    // capture time on the wall clock, kept in order for the time search
+    uint64_t now_mono = clock_us(CLOCK_MONOTONIC);
+    uint64_t age = pred.timestamp_us && now_mono > pred.timestamp_us ? now_mono - pred.timestamp_us : 0;
+    uint64_t time_us = std::max(clock_us(CLOCK_REALTIME) - age, last_time_us_);
+
+    tracker_.update(pred.boxes, pred.labels, frame);
+
+    std::vector<uint32_t> seen;
+    for (Track &track : tracker_.tracks()) {
+        seen.push_back(track.id);
+        if (track.missed || !track.stale)
+            continue;
+
+        // score of the detection the track was matched to
+        float score = 0;
+        for (size_t i = 0; i < pred.boxes.size(); i++) {
+            if (pred.boxes[i] == track.box)
+                score = pred.scores[i];
+        }
+
+        JournalEvent ev = {};
+        ev.time_us = time_us;
+        ev.track = track.id;
+        ev.label = track.detector_label;
+        ev.kind = live_.count(track.id) ? JOURNAL_CHANGE : JOURNAL_APPEAR;
+        ev.score = score;
+        ev.x = track.box.x;
+        ev.y = track.box.y;
+        ev.w = track.box.width;
+        ev.h = track.box.height;
+        snapshot(track.box, frame, ev);
+        append(ev);
+        tracker_.classified(track, track.detector_label, score);
+    }
+
+    std::vector<uint32_t> gone;
+    for (auto &it : live_) {
+        if (std::find(seen.begin(), seen.end(), it.first) == seen.end())
+            gone.push_back(it.first);
+    }
+    for (uint32_t track : gone) {
+        JournalEvent ev = {};
+        ev.time_us = time_us;
+        ev.track = track;
+        ev.label = live_[track].label;
+        ev.kind = JOURNAL_GONE;
+        ev.thumb = JOURNAL_NO_THUMB;
+        append(ev);
+    }
+}
+
+bool DetectionJournal::shelf_at(uint64_t time_us, std::vector<JournalItem> &items)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    items.clear();
+    if (!header_)
+        return false;
+    uint64_t count = std::min<uint64_t>(__atomic_load_n(&header_->count, __ATOMIC_ACQUIRE), JOURNAL_CAPACITY);
+    if (count == 0 || time_us < events_[0].time_us)
+        return false;
+
+    // last checkpoint at or before time_us, then the events up to it
+    auto cp = std::upper_bound(index_.begin() + 1, index_.end(), time_us,
+            [](uint64_t t, const Checkpoint &c) { return t < c.time_us; }) - 1;
+    std::map<uint32_t, JournalItem> state = cp->items;
+    for (uint64_t i = cp->index; i < count && events_[i].time_us <= time_us; i++)
+        apply(events_[i], state);
+
+    for (auto &it : state)
+        items.push_back(it.second);
+    return true;
+}
+
+std::vector<JournalItem> DetectionJournal::items()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    std::vector<JournalItem> out;
+    for (auto &it : live_)
+        out.push_back(it.second);
+    return out;
+}
+
+uint64_t DetectionJournal::events()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    return header_ ? header_->count : 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+#include "yolov4_tflite.h"
+#include "tracker.h"
+
+enum JournalEventKind
+{
+    JOURNAL_APPEAR = 0,         // a new track
+    JOURNAL_CHANGE = 1,         // its class or appearance changed
+    JOURNAL_GONE = 2,           // the track was lost, or the journal was reopened
+};
+
+#define JOURNAL_NO_THUMB 0xffff
+// the file being written and the full one before it, in the journal directory
+#define JOURNAL_FILE "journal.bin"
+#define JOURNAL_PREVIOUS_FILE "journal.1.bin"
+
+// one record of the journal file, fixed size so the file can be searched by time
+struct JournalEvent
+{
+    uint64_t time_us;           // CLOCK_REALTIME of the frame, never decreasing in a file
+    uint32_t track;
+    uint16_t label;
+    uint8_t kind;               // JournalEventKind
+    uint8_t reserved;
+    float score;
+    int16_t x, y, w, h;
+    uint16_t thumb;             // thumbnail slot, JOURNAL_NO_THUMB without one
+    uint16_t reserved2;
+};
+
+// an item on the shelf as of some event
+struct JournalItem
+{
+    uint32_t track = 0;
+    int label = 0;
+    float score = 0;
+    cv::Rect box;
+    uint64_t since_us = 0;      // time of its APPEAR event
+    uint16_t thumb = JOURNAL_NO_THUMB;  // last thumbnail taken of it
+};
+
+/*
+ * History of what the detector saw. Detections are tracked and only the
+ * changes are appended, to a memory mapped file of fixed size records: items
+ * appearing, changing and going away. When the file is full it is kept as
+ * journal.1.bin and a new one starts with the items then present.
+ *
+ * Thumbnails of new and changed items are encoded by a writer thread from a
+ * short queue; when the queue is full the snapshot is dropped, record() never
+ * waits on the disk. They go to a ring of numbered files so the directory
+ * stays bounded.
+ *
+ * A checkpoint of the items present is kept every few hundred events, so
+ * shelf_at() replays at most that many events.
+ */
+class DetectionJournal
+{
+public:
+    explicit DetectionJournal(const std::string &dir);
+    ~DetectionJournal();
+
+    // read_only only maps the file for queries, without a writer thread, and can open the previous file
+    bool open(bool read_only = false, const char *file = JOURNAL_FILE);
+
+    // frame is the RGB frame pred was computed on, or the BGRA one it was converted from
+    void record(const Prediction &pred, const cv::Mat &frame);
+
+    // items present at time_us (CLOCK_REALTIME), false if the file starts later
+    bool shelf_at(uint64_t time_us, std::vector<JournalItem> &items);
+    // items present after the last event
+    std::vector<JournalItem> items();
+
+    uint64_t events();
+    uint64_t dropped_snapshots() const { return dropped_.load(); }
+    std::string thumb_path(uint16_t slot) const;
+
+private:
+    struct Header;
+    struct Checkpoint
+    {
+        uint64_t index;         // events applied
+        uint64_t time_us;       // time of the last of them
+        std::map<uint32_t, JournalItem> items;
+    };
+    struct Snapshot
+    {
+        uint16_t slot;
+        cv::Mat crop;
+    };
+
+    std::string dir_;
+    bool read_only_ = false;
+    int fd_ = -1;
+    Header *header_ = nullptr;
+    JournalEvent *events_ = nullptr;
+    size_t map_size_ = 0;
+    std::mutex lock_;           // the mapping, the live items and the index
+
+    IouTracker tracker_;
+    std::map<uint32_t, JournalItem> live_;
+    std::vector<Checkpoint> index_;
+    uint64_t last_time_us_ = 0;
+    uint16_t next_thumb_ = 0;
+
+    std::thread writer_;
+    std::mutex queue_lock_;
+    std::condition_variable queue_cond_;
+    std::deque<Snapshot> queue_;
+    bool stop_ = false;
+    std::atomic<uint64_t> dropped_{0};
+
+    bool map_file(const std::string &path);
+    void unmap_file();
+    void rebuild_index();
+    void rotate();
+    void append(JournalEvent ev);
+    static void apply(const JournalEvent &ev, std::map<uint32_t, JournalItem> &items);
+    void snapshot(const cv::Rect &box, const cv::Mat &frame, JournalEvent &ev);
+    void writer_loop();
+};
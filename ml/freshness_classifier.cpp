@@ -0,0 +1,158 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "freshness_classifier.h"
+#include "ml_config.h"
+#include "tflite_delegate.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include <tensorflow/lite/kernels/register.h>
+
+// crops per Invoke() when the model's batch dimension can be resized
+#define CLASSIFIER_MAX_BATCH 4
+
+FreshnessClassifier::FreshnessClassifier()
+    : delegate_(nullptr, [](TfLiteDelegate *) {})
+{
+}
+
+FreshnessClassifier::~FreshnessClassifier() {}
+
+bool FreshnessClassifier::load(const std::string &model_path, int npu_tpye, int num_threads)
+{
+    std::ifstream file(model_path);
+    if (!file) {
+        printf("Failed to open %s \n", model_path.c_str());
+        return false;
+    }
+    model_ = tflite::FlatBufferModel::BuildFromFile(model_path.c_str());
+    if (!model_) {
+        printf("Failed to mmap model %s \n", model_path.c_str());
+        return false;
+    }
+
+    // delegates compiled for a fixed batch refuse the resize, fall back to one crop per invoke
+    if (!build_interpreter(npu_tpye, num_threads, CLASSIFIER_MAX_BATCH) &&
+        !build_interpreter(npu_tpye, num_threads, 1)) {
+        printf("Failed to set up %s classifier for %s \n", ml_delegate_name(npu_tpye), model_path.c_str());
+        return false;
+    }
+
+    TfLiteTensor *input = interpreter_->tensor(interpreter_->inputs()[0]);
+    batch_ = input->dims->data[0];
+    in_height_ = input->dims->data[1];
+    in_width_ = input->dims->data[2];
+    in_type_ = input->type;
+    if (input->dims->data[3] != 3 ||
+        (in_type_ != kTfLiteFloat32 && in_type_ != kTfLiteUInt8 && in_type_ != kTfLiteInt8)) {
+        printf("Classifier input type or shape not supported \n");
+        return false;
+    }
+
+    TfLiteTensor *output = interpreter_->tensor(interpreter_->outputs()[0]);
+    num_classes_ = output->dims->data[output->dims->size - 1];
+    if (output->type != kTfLiteFloat32 && output->type != kTfLiteUInt8 && output->type != kTfLiteInt8) {
+        printf("Classifier output type not supported \n");
+        return false;
+    }
+
+    printf("Classifier input [%d][%d][%d][3], %d classes \n", batch_, in_height_, in_width_, num_classes_);
+    return true;
+}
+
+bool FreshnessClassifier::build_interpreter(int npu_tpye, int num_threads, int batch)
+{
+    interpreter_.reset();
+    delegate_.reset();
+
+    tflite::ops::builtin::BuiltinOpResolverWithoutDefaultDelegates resolver;
+    tflite::InterpreterBuilder(*model_, resolver)(&interpreter_);
+    if (!interpreter_) {
+        printf("Failed to construct TFLite interpreter \n");
+        return false;
+    }
+    interpreter_->SetNumThreads(num_threads);
+
+    // the batch is fixed before the delegate partitions the graph
+    int input = interpreter_->inputs()[0];
+    TfLiteIntArray *dims = interpreter_->tensor(input)->dims;
+    if (batch != dims->data[0] &&
+        interpreter_->ResizeInputTensor(input, {batch, dims->data[1], dims->data[2], dims->data[3]}) != kTfLiteOk)
+        return false;
+
+    if (npu_tpye != ML_DELEGATE_CPU &&
+        !apply_tflite_delegate(*interpreter_, npu_tpye, num_threads, "", delegate_, delegate_cache_path_))
+        return false;
+
+    return interpreter_->AllocateTensors() == kTfLiteOk;
+}
+
+void FreshnessClassifier::seed_crop(const cv::Mat &crop, int slot)
+{
+    TfLiteTensor *input = interpreter_->tensor(interpreter_->inputs()[0]);
+    size_t plane = (size_t)in_height_ * in_width_ * 3;
+    cv::Size size(in_width_, in_height_);
+
+    // resize writes into the tensor when the destination already has the right size and type
+    if (in_type_ == kTfLiteUInt8) {
+        cv::Mat dst(size, CV_8UC3, input->data.uint8 + slot * plane);
+        cv::resize(crop, dst, size, 0, 0, cv::INTER_LINEAR);
+    } else if (in_type_ == kTfLiteInt8) {
+        cv::resize(crop, resized_, size, 0, 0, cv::INTER_LINEAR);
+        cv::Mat dst(size, CV_8SC3, input->data.int8 + slot * plane);
+        resized_.convertTo(dst, CV_8S, 1.0, -128.0);
+    } else {
+        cv::resize(crop, resized_, size, 0, 0, cv::INTER_LINEAR);
+        cv::Mat dst(size, CV_32FC3, input->data.f + slot * plane);
+        resized_.convertTo(dst, CV_32F, 1.0 / 255.0);
+    }
+}
+
+float FreshnessClassifier::output_score(const TfLiteTensor *output, int index)
+{
+    if (output->type == kTfLiteFloat32)
+        return output->data.f[index];
+    int q = output->type == kTfLiteUInt8 ? output->data.uint8[index] : output->data.int8[index];
+    return (q - output->params.zero_point) * output->params.scale;
+}
+
+bool FreshnessClassifier::classify(const std::vector<cv::Mat> &crops, std::vector<int> &labels,
+        std::vector<float> &scores)
+{
+    labels.clear();
+    scores.clear();
+
+    for (size_t first = 0; first < crops.size(); first += batch_) {
+        int count = std::min((int)(crops.size() - first), batch_);
+        for (int i = 0; i < count; i++)
+            seed_crop(crops[first + i], i);
+
+        // unused slots keep the previous crops, their outputs are ignored
+        if (interpreter_->Invoke() != kTfLiteOk) {
+            printf("Failed to run the classifier \n");
+            return false;
+        }
+
+        const TfLiteTensor *output = interpreter_->tensor(interpreter_->outputs()[0]);
+        for (int i = 0; i < count; i++) {
+            int best = 0;
+            float best_score = output_score(output, i * num_classes_);
+            for (int j = 1; j < num_classes_; j++) {
+                float score = output_score(output, i * num_classes_ + j);
+                if (score > best_score) {
+                    best = j;
+                    best_score = score;
+                }
+            }
+            labels.push_back(best);
+            scores.push_back(best_score);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tensorflow/lite/model.h>
+#include <tensorflow/lite/interpreter.h>
+
+#include <opencv2/opencv.hpp>
+
+/*
+ * Second stage of the two stage pipeline: a small image classifier run on
+ * the fruit crops found by the detector. Crops are resized straight into the
+ * input tensor, up to batch() of them per Invoke().
+ */
+class FreshnessClassifier
+{
+public:
+    FreshnessClassifier();
+    ~FreshnessClassifier();
+
+    // npu_tpye is one of MLDelegate except ML_DELEGATE_AUTO, reports errors and returns false
+    bool load(const std::string &model_path, int npu_tpye, int num_threads);
+
+    // crops are views into the frame, labels and scores get one entry per crop
+    bool classify(const std::vector<cv::Mat> &crops, std::vector<int> &labels, std::vector<float> &scores);
+
+    int batch() const { return batch_; }
+    int num_classes() const { return num_classes_; }
+
+private:
+    // model's and the delegate must outlive the interpreter using them
+    std::unique_ptr<tflite::FlatBufferModel> model_;
+    tflite::Interpreter::TfLiteDelegatePtr delegate_;
+    std::unique_ptr<tflite::Interpreter> interpreter_;
+    std::string delegate_cache_path_;
+
+    int batch_ = 1;
+    int in_height_ = 0;
+    int in_width_ = 0;
+    int in_type_ = 0;
+    int num_classes_ = 0;
+    cv::Mat resized_;   // float inputs only, converted into the tensor afterwards
+
+    bool build_interpreter(int npu_tpye, int num_threads, int batch);
+    void seed_crop(const cv::Mat &crop, int slot);
+    float output_score(const TfLiteTensor *output, int index);
+};
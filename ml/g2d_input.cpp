@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "g2d_input.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// G2D wants the destination stride in multiples of this many pixels
+#define G2D_STRIDE_ALIGN 16
+
+G2DInput::~G2DInput()
+{
+    if (buf_)
+        g2d_free(buf_);
+    if (handle_)
+        g2d_close(handle_);
+}
+
+bool G2DInput::open()
+{
+    if (g2d_open(&handle_)) {
+        printf("g2d_open fail for the ML input \n");
+        handle_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool G2DInput::setup(int width, int height)
+{
+    if (buf_ && width == width_ && height == height_)
+        return true;
+    if (buf_)
+        g2d_free(buf_);
+
+    width_ = width;
+    height_ = height;
+    stride_ = (width + G2D_STRIDE_ALIGN - 1) / G2D_STRIDE_ALIGN * G2D_STRIDE_ALIGN;
+    // cacheable, the CPU or the delegate reads it after every blit
+    buf_ = g2d_alloc(stride_ * height_ * 3, 1);
+    if (!buf_) {
+        printf("g2d_alloc fail for a %dx%d ML input \n", width_, height_);
+        return false;
+    }
+    // the letterbox rows below the frame are never blitted, they stay black;
+    // flushed so no dirty line lands on top of a later blit
+    memset(buf_->buf_vaddr, 0, stride_ * height_ * 3);
+    g2d_cache_op(buf_, G2D_CACHE_FLUSH);
+    bound_ = false;
+    return true;
+}
+
+bool G2DInput::convert(YOLOV4 &model, struct g2d_buf *frame, int width, int height)
+{
+    auto t0 = std::chrono::steady_clock::now();
+
+    if (!handle_ || !setup(model.input_width(), model.input_height()))
+        return false;
+
+    // padded at the bottom to a square of the frame width like YOLOV4::preprocess()
+    int scaled_height = height_ * height / width;
+
+    struct g2d_surface src, dst;
+    memset(&src, 0, sizeof(src));
+    memset(&dst, 0, sizeof(dst));
+    src.format = G2D_ARGB8888;
+    src.planes[0] = frame->buf_paddr;
+    src.right = width;
+    src.bottom = height;
+    src.stride = width;
+    src.width = width;
+    src.height = height;
+    src.rot = G2D_ROTATION_0;
+    // G2D names formats by word, BGR888 is R, G, B in memory
+    dst.format = G2D_BGR888;
+    dst.planes[0] = buf_->buf_paddr;
+    dst.right = width_;
+    dst.bottom = scaled_height;
+    dst.stride = stride_;
+    dst.width = width_;
+    dst.height = height_;
+    dst.rot = G2D_ROTATION_0;
+    if (g2d_blit(handle_, &src, &dst) || g2d_finish(handle_)) {
+        printf("G2D cannot produce the ML input, back to the CPU \n");
+        g2d_close(handle_);
+        handle_ = nullptr;
+        return false;
+    }
+    g2d_cache_op(buf_, G2D_CACHE_INVALIDATE);
+
+    // a new model after a reload binds again, padded rows cannot be a tensor
+    bound_ = stride_ == width_ && model.bind_input(buf_->buf_vaddr, stride_ * height_ * 3);
+    if (!bound_) {
+        cv::Mat resized(height_, width_, CV_8UC3, buf_->buf_vaddr, stride_ * 3);
+        model.seed_input(resized);
+    }
+
+    convert_ms_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    return true;
+}
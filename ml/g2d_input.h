@@ -0,0 +1,44 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <g2d.h>
+
+#include "yolov4_tflite.h"
+
+/*
+ * Fills the detector's input with G2D instead of the CPU: one blit converts
+ * the BGRA camera frame to RGB, scales it and letterboxes it into a buffer in
+ * the input tensor layout. When the model takes that buffer as its input
+ * tensor nothing is copied at all, otherwise it is copied into the tensor
+ * once, which also normalizes it for float models.
+ */
+class G2DInput
+{
+public:
+    ~G2DInput();
+
+    bool open();
+
+    // frame is a BGRA G2D buffer of width x height, then model.run_prepared() runs on it
+    bool convert(YOLOV4 &model, struct g2d_buf *frame, int width, int height);
+
+    double convert_ms() const { return convert_ms_; }
+    // the buffer is the model's input tensor, nothing is copied into it
+    bool bound() const { return bound_; }
+
+private:
+    void *handle_ = nullptr;
+    struct g2d_buf *buf_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+    int stride_ = 0;            // pixels, padded for G2D
+    bool bound_ = false;
+    double convert_ms_ = 0;
+
+    bool setup(int width, int height);
+};
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "inference_pool.h"
+
+#include <cstdio>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+InferencePool::InferencePool(ModelReloader &models, ResultCallback callback)
+    : models_(models), callback_(callback)
+{
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu < 1)
+        ncpu = 1;
+
+    for (int i = 0; i < models_.slots(); i++) {
+        std::unique_ptr<Worker> worker(new Worker);
+        worker->slot = i;
+        worker->cpu = i % ncpu;
+        workers_.push_back(std::move(worker));
+    }
+}
+
+InferencePool::~InferencePool()
+{
+    stop();
+}
+
+void InferencePool::start()
+{
+    for (auto &worker : workers_) {
+        worker->thread = std::thread(&InferencePool::work, this, worker.get());
+
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(worker->cpu, &cpuset);
+        if (pthread_setaffinity_np(worker->thread.native_handle(), sizeof(cpuset), &cpuset) != 0)
+            printf("Failed to pin inference worker %d to cpu %d \n", worker->slot, worker->cpu);
+    }
+    printf("Inference pool started with %d workers \n", workers());
+}
+
+void InferencePool::stop()
+{
+    stop_ = true;
+    for (auto &worker : workers_) {
+        // taking the lock orders the store before a waiting worker checks it
+        std::lock_guard<std::mutex> guard(worker->lock);
+        worker->cond.notify_one();
+    }
+    for (auto &worker : workers_) {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+}
+
+bool InferencePool::submit(const cv::Mat &frame, uint64_t frame_seq, uint64_t timestamp_us)
+{
+    Worker *worker = workers_[next_worker_].get();
+    {
+        std::lock_guard<std::mutex> guard(worker->lock);
+        if (worker->busy)
+            return false;
+
+        // the worker keeps its buffer, so this only allocates on the first frame
+        frame.copyTo(worker->frame);
+        worker->frame_seq = frame_seq;
+        worker->timestamp_us = timestamp_us;
+        worker->ticket = next_ticket_++;
+        worker->submitted = std::chrono::steady_clock::now();
+        worker->busy = true;
+    }
+    worker->cond.notify_one();
+
+    next_worker_ = (next_worker_ + 1) % workers_.size();
+    return true;
+}
+
+void InferencePool::work(Worker *worker)
+{
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(worker->lock);
+            worker->cond.wait(guard, [&] { return worker->busy || stop_; });
+            if (stop_)
+                return;
+        }
+
+        // busy is set, submit() leaves frame and ticket alone until it is cleared
+        InferenceResult result;
+        result.frame_seq = worker->frame_seq;
+        models_.get(worker->slot)->run(worker->frame, result.pred);
+        result.pred.frame_seq = worker->frame_seq;
+        result.pred.timestamp_us = worker->timestamp_us;
+        result.latency_ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - worker->submitted).count();
+        uint64_t ticket = worker->ticket;
+
+        {
+            std::lock_guard<std::mutex> guard(worker->lock);
+            worker->busy = false;
+        }
+
+        deliver(ticket, result);
+    }
+}
+
+void InferencePool::deliver(uint64_t ticket, InferenceResult &result)
+{
+    std::lock_guard<std::mutex> guard(results_lock_);
+    results_[ticket] = std::move(result);
+
+    // hand out everything that is now in order
+    while (!results_.empty() && results_.begin()->first == deliver_ticket_) {
+        callback_(results_.begin()->second);
+        results_.erase(results_.begin());
+        deliver_ticket_++;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "model_reloader.h"
+
+struct InferenceResult
+{
+    uint64_t frame_seq;     // sequence given to submit()
+    Prediction pred;
+    double latency_ms;      // submit() to end of run()
+};
+
+/*
+ * Pipelines consecutive frames over several interpreters, one worker thread
+ * per ModelReloader slot, each pinned to its own core. Frames go to the
+ * workers round-robin and results are delivered in submission order.
+ */
+class InferencePool
+{
+public:
+    using ResultCallback = std::function<void(InferenceResult &result)>;
+
+    // callback runs on a worker thread, one call at a time, in frame order
+    InferencePool(ModelReloader &models, ResultCallback callback);
+    ~InferencePool();
+
+    void start();
+    void stop();
+
+    // copies the RGB frame to the next worker, false (frame dropped) when it is still busy,
+    // the prediction is stamped with frame_seq and the capture time
+    bool submit(const cv::Mat &frame, uint64_t frame_seq, uint64_t timestamp_us = 0);
+
+    int workers() const { return (int)workers_.size(); }
+
+private:
+    struct Worker
+    {
+        int slot;
+        int cpu;
+        std::thread thread;
+        std::mutex lock;
+        std::condition_variable cond;
+        bool busy = false;
+        cv::Mat frame;
+        uint64_t frame_seq = 0;
+        uint64_t timestamp_us = 0;
+        uint64_t ticket = 0;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    ModelReloader &models_;
+    ResultCallback callback_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    size_t next_worker_ = 0;
+    uint64_t next_ticket_ = 0;
+    // read by every worker under its own lock, so not guarded by any of them
+    std::atomic<bool> stop_{false};
+
+    // results waiting for an earlier ticket to finish
+    std::mutex results_lock_;
+    std::map<uint64_t, InferenceResult> results_;
+    uint64_t deliver_ticket_ = 0;
+
+    void work(Worker *worker);
+    void deliver(uint64_t ticket, InferenceResult &result);
+};
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "inventory.h"
+
+#include <cstdio>
+#include <ctime>
+
+#include <unistd.h>
+
+#define INVENTORY_MAGIC 0x564e4946  // "FINV"
+#define INVENTORY_VERSION 1
+// results in a row needed to add an item, and to remove one
+#define INVENTORY_ADD_RESULTS 5
+#define INVENTORY_REMOVE_RESULTS 15
+// results a track is kept through without a detection
+#define INVENTORY_TRACK_MISSED 3
+// shortest time between two snapshot writes, the flash is not rewritten on every change
+#define INVENTORY_SAVE_PERIOD_US (60 * 1000000ULL)
+
+static uint64_t clock_us(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const char *label_name(const std::vector<std::string> &labels, int i)
+{
+    return i < (int)labels.size() ? labels[i].c_str() : "?";
+}
+
+Inventory::Inventory(const std::string &snapshot_path, int num_classes)
+    : path_(snapshot_path), classes_(num_classes), seen_(num_classes, 0),
+      tracker_(0.3f, INVENTORY_TRACK_MISSED)
+{
+}
+
+void Inventory::flush()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    if (dirty_)
+        save();
+}
+
+bool Inventory::load()
+{
+    FILE *fp = fopen(path_.c_str(), "rb");
+    if (!fp)
+        return false;
+
+    // magic, version, class count, then per class its count and the arrival times
+    uint32_t head[3];
+    bool ok = fread(head, sizeof(head), 1, fp) == 1 && head[0] == INVENTORY_MAGIC &&
+              head[1] == INVENTORY_VERSION && head[2] == classes_.size();
+    std::vector<InventoryClass> classes(classes_.size());
+    for (size_t i = 0; ok && i < classes.size(); i++) {
+        uint32_t count;
+        ok = fread(&count, sizeof(count), 1, fp) == 1 && count < 0x10000;
+        if (!ok)
+            break;
+        classes[i].count = count;
+        classes[i].candidate = count;
+        classes[i].since_us.resize(count);
+        ok = count == 0 || fread(classes[i].since_us.data(), sizeof(uint64_t), count, fp) == count;
+    }
+    fclose(fp);
+
+    if (!ok) {
+        printf("Inventory snapshot %s ignored \n", path_.c_str());
+        return false;
+    }
+    classes_ = classes;
+    return true;
+}
+
+bool Inventory::save()
+{
+    // written aside then renamed, a power cut leaves the previous snapshot
+    std::string tmp = path_ + ".tmp";
+    FILE *fp = fopen(tmp.c_str(), "wb");
+    if (!fp)
+        return false;
+
+    uint32_t head[3] = {INVENTORY_MAGIC, INVENTORY_VERSION, (uint32_t)classes_.size()};
+    bool ok = fwrite(head, sizeof(head), 1, fp) == 1;
+    for (const InventoryClass &c : classes_) {
+        uint32_t count = c.count;
+        ok = ok && fwrite(&count, sizeof(count), 1, fp) == 1;
+        ok = ok && (count == 0 || fwrite(c.since_us.data(), sizeof(uint64_t), count, fp) == count);
+    }
+    ok = fflush(fp) == 0 && ok;
+    fsync(fileno(fp));
+    fclose(fp);
+
+    saved_us_ = clock_us(CLOCK_MONOTONIC);
+    if (!ok || rename(tmp.c_str(), path_.c_str()) != 0) {
+        printf("Cannot write inventory snapshot %s \n", path_.c_str());
+        unlink(tmp.c_str());
+        return false;
+    }
+    dirty_ = false;
+    return true;
+}
+
+bool Inventory::update(const Prediction &pred)
+{
+    // no frame, the tracks are matched on their boxes alone
+    tracker_.update(pred.boxes, pred.labels, cv::Mat());
+    for (const Track &track : tracker_.tracks()) {
+        if (track.detector_label >= 0 && track.detector_label < (int)seen_.size())
+            seen_[track.detector_label]++;
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    bool changed = false;
+    uint64_t now = 0;
+    for (size_t i = 0; i < classes_.size(); i++) {
+        InventoryClass &c = classes_[i];
+        int seen = seen_[i];
+        seen_[i] = 0;
+
+        if (seen == c.count) {
+            c.candidate = seen;
+            c.streak = 0;
+            continue;
+        }
+        if (seen != c.candidate) {
+            c.candidate = seen;
+            c.streak = 0;
+        }
+        c.streak++;
+        if (c.streak < (seen > c.count ? INVENTORY_ADD_RESULTS : INVENTORY_REMOVE_RESULTS))
+            continue;
+
+        // the newest items are the ones taken out
+        if (!now)
+            now = clock_us(CLOCK_REALTIME);
+        c.since_us.resize(seen, now);
+        c.count = seen;
+        c.streak = 0;
+        changed = true;
+    }
+
+    if (changed)
+        dirty_ = true;
+    if (dirty_ && clock_us(CLOCK_MONOTONIC) - saved_us_ >= INVENTORY_SAVE_PERIOD_US)
+        save();
+    return changed;
+}
+
+std::string Inventory::summary(const std::vector<std::string> &labels) const
+{
+    std::string out;
+    for (size_t i = 0; i < classes_.size(); i++) {
+        if (!classes_[i].count)
+            continue;
+        if (!out.empty())
+            out += ", ";
+        out += std::to_string(classes_[i].count) + " " + label_name(labels, i);
+    }
+    return out.empty() ? "Nothing in the fridge" : out;
+}
+
+std::string Inventory::describe(const std::vector<std::string> &labels) const
+{
+    uint64_t now = clock_us(CLOCK_REALTIME);
+    std::string out;
+    for (size_t i = 0; i < classes_.size(); i++) {
+        const InventoryClass &c = classes_[i];
+        if (!c.count)
+            continue;
+        uint64_t age_min = now > c.since_us.front() ? (now - c.since_us.front()) / 60000000 : 0;
+        char line[128];
+        snprintf(line, sizeof(line), "%3d %-20s oldest %llu h %02llu min\n", c.count, label_name(labels, i),
+                (unsigned long long)(age_min / 60), (unsigned long long)(age_min % 60));
+        out += line;
+    }
+    return out;
+}
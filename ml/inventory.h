@@ -0,0 +1,63 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "yolov4_tflite.h"
+#include "tracker.h"
+
+struct InventoryClass
+{
+    int count = 0;                  // items believed to be in the fridge
+    std::vector<uint64_t> since_us; // wall clock arrival of each of them, oldest first
+    int candidate = 0;              // count the results have been showing instead
+    int streak = 0;                 // consecutive results showing candidate
+};
+
+/*
+ * Items per class, folded from the tracked detections: every track counts
+ * once for its class, also through the few results it is missed in, and a
+ * class only changes its count once the results agree on the new one for a
+ * few updates in a row, adding sooner than removing so a hand in front of
+ * the shelf does not empty it. The counts are written to a small snapshot
+ * file that load() replays, at most once a minute and on flush().
+ */
+class Inventory
+{
+public:
+    Inventory(const std::string &snapshot_path, int num_classes);
+
+    // the snapshot of the last run, false without a usable one
+    bool load();
+
+    // true when the inventory changed
+    bool update(const Prediction &pred);
+    // saves what changed since the last snapshot, from any thread not in update()
+    void flush();
+
+    // "3 fresh apple, 1 rotten banana" for the home screen
+    std::string summary(const std::vector<std::string> &labels) const;
+    // one line per class with the age of its oldest item
+    std::string describe(const std::vector<std::string> &labels) const;
+
+    const std::vector<InventoryClass> &classes() const { return classes_; }
+
+private:
+    std::string path_;
+    std::vector<InventoryClass> classes_;
+    std::vector<int> seen_;         // per class count of the current result
+    IouTracker tracker_;
+    std::mutex lock_;               // the counts, between update() and flush()
+    bool dirty_ = false;            // changed since the snapshot was saved
+    uint64_t saved_us_ = 0;         // CLOCK_MONOTONIC of the last save
+
+    bool save();
+};
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+/*
+ * Hands the newest value of one or more producers to one consumer, a triple
+ * buffer. publish() overwrites a value the consumer did not take yet, so
+ * after a stall the consumer gets the latest one, never a stale one. The
+ * consumer is lock-free and never waits for a producer; producers only
+ * serialize among themselves, e.g. the workers of an inference pool.
+ */
+template <typename T>
+class LatestValue
+{
+public:
+    void publish(const T &item)
+    {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        buffers_[back_] = item;
+        int prev = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel);
+        if (prev & FRESH)
+            overwritten_.fetch_add(1, std::memory_order_relaxed);
+        back_ = prev & INDEX;
+    }
+
+    // consumer thread only, false when nothing was published since the last take
+    bool take(T &item)
+    {
+        if (!(middle_.load(std::memory_order_relaxed) & FRESH))
+            return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+        item = buffers_[front_];
+        return true;
+    }
+
+    // values replaced before the consumer took them, since start
+    uint64_t overwritten() const { return overwritten_.load(std::memory_order_relaxed); }
+
+private:
+    static const int INDEX = 3;
+    static const int FRESH = 4;
+
+    std::mutex write_lock_;
+    int back_ = 0;                      // written by the producers
+    alignas(64) std::atomic<int> middle_{1};    // last published, FRESH until taken
+    alignas(64) int front_ = 2;         // read by the consumer
+    std::atomic<uint64_t> overwritten_{0};
+    T buffers_[3];
+};
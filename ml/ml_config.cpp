@@ -0,0 +1,149 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ml_config.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+static const char *delegate_names[] = {"cpu", "vx", "ethosu", "xnnpack", "auto"};
+static const char *overlay_names[] = {"latest", "hold", "compensate", "auto"};
+
+static std::string trim(const std::string &s)
+{
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos)
+        return "";
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+int ml_delegate_from_string(const std::string &name)
+{
+    for (int i = 0; i < (int)(sizeof(delegate_names) / sizeof(delegate_names[0])); i++) {
+        if (name == delegate_names[i])
+            return i;
+    }
+    return -1;
+}
+
+const char *ml_delegate_name(int delegate)
+{
+    if (delegate < 0 || delegate >= (int)(sizeof(delegate_names) / sizeof(delegate_names[0])))
+        return "unknown";
+    return delegate_names[delegate];
+}
+
+int overlay_mode_from_string(const std::string &name)
+{
+    for (int i = 0; i < (int)(sizeof(overlay_names) / sizeof(overlay_names[0])); i++) {
+        if (name == overlay_names[i])
+            return i;
+    }
+    return -1;
+}
+
+const char *overlay_mode_name(int mode)
+{
+    if (mode < 0 || mode >= (int)(sizeof(overlay_names) / sizeof(overlay_names[0])))
+        return "unknown";
+    return overlay_names[mode];
+}
+
+bool load_ml_config(const std::string &path, MLConfig &config)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    std::string line;
+    int line_num = 0;
+    while (std::getline(file, line)) {
+        line_num++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos)
+            line.erase(comment);
+        line = trim(line);
+        if (line.empty())
+            continue;
+
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) {
+            printf("%s:%d: missing '='\n", path.c_str(), line_num);
+            continue;
+        }
+        std::string key = trim(line.substr(0, eq));
+        std::string value = trim(line.substr(eq + 1));
+
+        if (key == "model") {
+            config.model_path = value;
+        } else if (key == "labels") {
+            config.labels_path = value;
+        } else if (key == "boxes") {
+            if (value == "xywh")
+                config.box_format = BOX_XYWH;
+            else if (value == "xyxy")
+                config.box_format = BOX_XYXY;
+            else
+                printf("%s:%d: unknown box format '%s'\n", path.c_str(), line_num, value.c_str());
+        } else if (key == "delegate") {
+            int delegate = ml_delegate_from_string(value);
+            if (delegate < 0)
+                printf("%s:%d: unknown delegate '%s'\n", path.c_str(), line_num, value.c_str());
+            else
+                config.delegate = delegate;
+        } else if (key == "threads") {
+            int threads = atoi(value.c_str());
+            if (threads > 0)
+                config.num_threads = threads;
+        } else if (key == "workers") {
+            int workers = atoi(value.c_str());
+            if (workers > 0)
+                config.num_workers = workers;
+        } else if (key == "profile") {
+            config.profile = atoi(value.c_str()) != 0;
+        } else if (key == "classifier") {
+            config.classifier_path = value;
+        } else if (key == "overlay") {
+            int overlay = overlay_mode_from_string(value);
+            if (overlay < 0)
+                printf("%s:%d: unknown overlay mode '%s'\n", path.c_str(), line_num, value.c_str());
+            else
+                config.overlay = overlay;
+        } else if (key == "hold_budget_ms") {
+            config.hold_budget_ms = atof(value.c_str());
+        } else if (key == "compensate_budget_ms") {
+            config.compensate_budget_ms = atof(value.c_str());
+        } else if (key == "full_frame_period") {
+            config.full_frame_period = atoi(value.c_str());
+        } else if (key == "roi_size") {
+            int size = atoi(value.c_str());
+            if (size > 0)
+                config.roi_size = size;
+        } else if (key == "roi") {
+            MLRoi roi;
+            if (sscanf(value.c_str(), "%d , %d , %d , %d", &roi.x, &roi.y, &roi.w, &roi.h) == 4 &&
+                roi.w > 0 && roi.h > 0)
+                config.rois.push_back(roi);
+            else
+                printf("%s:%d: roi is x,y,w,h, got '%s'\n", path.c_str(), line_num, value.c_str());
+        } else if (key == "inventory") {
+            config.inventory_path = value;
+        } else if (key == "journal") {
+            config.journal_dir = value;
+        } else if (key == "g2d_input") {
+            config.g2d_input = atoi(value.c_str()) != 0;
+        } else if (key == "budget_ms") {
+            double budget = atof(value.c_str());
+            if (budget >= 0)
+                config.budget_ms = budget;
+        } else {
+            printf("%s:%d: unknown key '%s'\n", path.c_str(), line_num, key.c_str());
+        }
+    }
+    return true;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// delegate used to run the model, also the value of "delegate" in ml.conf
+enum MLDelegate
+{
+    ML_DELEGATE_CPU = 0,        // plain TFLite reference/optimized kernels
+    ML_DELEGATE_VX = 1,         // i.MX8MP VeriSilicon NPU external delegate
+    ML_DELEGATE_ETHOSU = 2,     // i.MX93 Ethos-U65 external delegate
+    ML_DELEGATE_XNNPACK = 3,    // XNNPACK on the Cortex-A cores
+    ML_DELEGATE_AUTO = 4,       // benchmark the available ones and keep the fastest
+};
+
+// box coordinates in input pixels: center and size, or the two corners
+enum BoxFormat
+{
+    BOX_XYWH = 0,
+    BOX_XYXY = 1,
+};
+
+// anchor-first tensors are [1][anchors][values], class-first ones [1][values][anchors]
+enum TensorLayout
+{
+    LAYOUT_ANCHOR_FIRST = 0,
+    LAYOUT_CLASS_FIRST = 1,
+};
+
+// how the boxes are lined up with the preview, also the value of "overlay" in ml.conf
+enum OverlayMode
+{
+    OVERLAY_LATEST = 0,         // live preview, boxes of the last result as they are
+    OVERLAY_HOLD = 1,           // preview shows the inferred frame once its result arrives
+    OVERLAY_COMPENSATE = 2,     // live preview, boxes moved by their velocity to each frame
+    OVERLAY_AUTO = 3,           // picked from the measured result latency
+};
+
+// region of interest of the frame, in camera pixels
+struct MLRoi
+{
+    int x, y, w, h;
+};
+
+struct MLConfig
+{
+    std::string model_path = "/usr/share/ml_model/yolov4-tiny-freshness-vela.tflite";
+    std::string labels_path = "/usr/share/ml_model/freshness_labels.txt";
+    int box_format = 0;         // BoxFormat of the box output, center-size by default
+    int delegate = ML_DELEGATE_ETHOSU;
+    int num_threads = 2;
+    int num_workers = 1;        // interpreters pipelining frames, one per core
+    bool profile = false;       // per operator profiling of the interpreters
+    std::string classifier_path;    // second stage freshness classifier, empty for one stage
+    double budget_ms = 0;       // detect plus classify time per frame, 0 for no limit
+    int overlay = 3;            // OverlayMode, auto by default
+    double hold_budget_ms = 100;        // preview delay accepted to hold it on the inferred frame
+    double compensate_budget_ms = 300;  // furthest the boxes are extrapolated
+    int full_frame_period = 0;  // one full frame inference in N, regions otherwise, 0 for always full
+    int roi_size = 320;         // smallest side of a region
+    std::vector<MLRoi> rois;
+    bool g2d_input = true;      // G2D fills the detector input, the CPU when off or unsupported
+    std::string journal_dir;    // detection journal and thumbnails, empty for none
+    std::string inventory_path;     // inventory snapshot, empty for no inventory
+};
+
+/*
+ * ml.conf is a plain "key = value" file, '#' starts a comment:
+ *   model    = /usr/share/ml_model/yolov4-tiny-freshness-vela.tflite
+ *   labels   = /usr/share/ml_model/freshness_labels.txt, one class name per line
+ *   boxes    = xywh | xyxy
+ *   delegate = cpu | vx | ethosu | xnnpack | auto
+ *   threads  = 2
+ *   workers  = 1
+ *   profile  = 0 | 1
+ *   classifier = /usr/share/ml_model/freshness-classifier.tflite
+ *   budget_ms  = 40
+ *   overlay  = latest | hold | compensate | auto
+ *   hold_budget_ms       = 100
+ *   compensate_budget_ms = 300
+ *   full_frame_period = 8
+ *   roi_size = 320
+ *   roi      = x,y,w,h, repeated for several regions
+ *   g2d_input = 0 | 1
+ *   journal  = /var/lib/fridge-journal
+ *   inventory = /var/lib/lvgl_demo/inventory.bin, off when missing or empty
+ * A missing file keeps the defaults above.
+ */
+bool load_ml_config(const std::string &path, MLConfig &config);
+
+int ml_delegate_from_string(const std::string &name);
+const char *ml_delegate_name(int delegate);
+
+int overlay_mode_from_string(const std::string &name);
+const char *overlay_mode_name(int mode);
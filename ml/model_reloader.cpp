@@ -0,0 +1,131 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "model_reloader.h"
+
+#include <chrono>
+#include <cstdio>
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+// wait for the file to be quiet this long before loading it
+#define RELOAD_SETTLE_MS 1000
+#define WATCH_POLL_MS 500
+
+ModelReloader::ModelReloader(const std::string &model_path, int npu_tpye, int num_threads, int slots)
+    : model_path_(model_path), npu_tpye_(npu_tpye), num_threads_(num_threads),
+      generation_(0), stop_(false), inotify_fd_(-1)
+{
+    size_t slash = model_path_.find_last_of('/');
+    model_dir_ = slash == std::string::npos ? "." : model_path_.substr(0, slash);
+    model_name_ = slash == std::string::npos ? model_path_ : model_path_.substr(slash + 1);
+
+    for (int i = 0; i < (slots > 0 ? slots : 1); i++)
+        current_.push_back(std::make_shared<YOLOV4>(model_path_, npu_tpye_, num_threads_));
+}
+
+ModelReloader::~ModelReloader()
+{
+    stop_ = true;
+    if (watcher_.joinable())
+        watcher_.join();
+    if (inotify_fd_ >= 0)
+        close(inotify_fd_);
+}
+
+bool ModelReloader::start()
+{
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0) {
+        printf("Model reload disabled, inotify_init1: %s \n", strerror(errno));
+        return false;
+    }
+
+    // watch the directory, tools usually replace the model by writing a new file and renaming it
+    if (inotify_add_watch(inotify_fd_, model_dir_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        printf("Model reload disabled, cannot watch %s: %s \n", model_dir_.c_str(), strerror(errno));
+        close(inotify_fd_);
+        inotify_fd_ = -1;
+        return false;
+    }
+
+    watcher_ = std::thread(&ModelReloader::watch, this);
+    printf("Watching %s for model updates \n", model_path_.c_str());
+    return true;
+}
+
+std::shared_ptr<YOLOV4> ModelReloader::get(int slot)
+{
+    return std::atomic_load(&current_[slot]);
+}
+
+void ModelReloader::watch()
+{
+    bool pending = false;
+    auto last_event = std::chrono::steady_clock::now();
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    while (!stop_) {
+        struct pollfd pfd = {inotify_fd_, POLLIN, 0};
+        int ret = poll(&pfd, 1, WATCH_POLL_MS);
+
+        if (ret > 0 && (pfd.revents & POLLIN)) {
+            ssize_t len;
+            while ((len = read(inotify_fd_, buf, sizeof(buf))) > 0) {
+                for (char *ptr = buf; ptr < buf + len; ) {
+                    const struct inotify_event *event = (const struct inotify_event *)ptr;
+                    if (event->len && model_name_ == event->name) {
+                        pending = true;
+                        last_event = std::chrono::steady_clock::now();
+                    }
+                    ptr += sizeof(struct inotify_event) + event->len;
+                }
+            }
+        }
+
+        if (pending && std::chrono::steady_clock::now() - last_event >=
+                std::chrono::milliseconds(RELOAD_SETTLE_MS)) {
+            pending = false;
+            reload();
+        }
+    }
+}
+
+bool ModelReloader::reload()
+{
+    printf("Model %s changed, reloading in background \n", model_path_.c_str());
+
+    // the old instances keep serving frames while these are built
+    std::vector<std::shared_ptr<YOLOV4>> next(current_.size());
+    for (size_t i = 0; i < next.size(); i++) {
+        next[i] = std::make_shared<YOLOV4>();
+        if (!next[i]->load(model_path_, npu_tpye_, num_threads_)) {
+            printf("Reload of %s failed, keeping the current model \n", model_path_.c_str());
+            return false;
+        }
+        if (!next[i]->warmup()) {
+            printf("Warm-up of %s failed, keeping the current model \n", model_path_.c_str());
+            return false;
+        }
+    }
+
+    // frames in flight hold their own reference, an old model goes away with the last one
+    for (size_t i = 0; i < next.size(); i++) {
+        auto old = std::atomic_load(&current_[i]);
+        next[i]->confThreshold = old->confThreshold;
+        next[i]->nmsThreshold = old->nmsThreshold;
+        next[i]->box_format = old->box_format;
+        next[i]->set_labels(old->labels());
+        next[i]->set_profiling(old->profiling());
+        std::atomic_store(&current_[i], next[i]);
+    }
+    generation_++;
+    printf("Swapped to reloaded model %s, generation %d \n", model_path_.c_str(), generation_.load());
+    return true;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "yolov4_tflite.h"
+
+/*
+ * Watches the model file and rebuilds the interpreter in the background when
+ * it is replaced. The new instance only becomes visible after a successful
+ * warm-up inference, until then get() keeps returning the old one, so the
+ * inference thread never waits for a reload.
+ */
+class ModelReloader
+{
+public:
+    /*
+     * builds the first models synchronously, exits on failure like YOLOV4.
+     * Every slot gets its own interpreter, so that slots can run in parallel.
+     */
+    ModelReloader(const std::string &model_path, int npu_tpye, int num_threads, int slots = 1);
+    ~ModelReloader();
+
+    // start the watcher thread
+    bool start();
+
+    // model for the next frame, hold the pointer for the whole inference
+    std::shared_ptr<YOLOV4> get(int slot = 0);
+    int slots() const { return (int)current_.size(); }
+
+    // number of successful swaps since start
+    int generation() const { return generation_; }
+
+private:
+    std::string model_path_;
+    std::string model_dir_;
+    std::string model_name_;
+    int npu_tpye_;
+    int num_threads_;
+
+    // one per slot, only accessed with std::atomic_load/store
+    std::vector<std::shared_ptr<YOLOV4>> current_;
+    std::atomic<int> generation_;
+    std::atomic<bool> stop_;
+    int inotify_fd_;
+    std::thread watcher_;
+
+    void watch();
+    bool reload();
+};
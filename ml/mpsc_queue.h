@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Bounded multi-producer single-consumer ring, lock-free. push() can run on
+ * any number of threads and pop() on one. Every slot carries a sequence
+ * number telling whether it is free for the producer of a given position or
+ * filled for the consumer, so producers only contend on the head index.
+ * Capacity must be a power of two.
+ */
+template <typename T, size_t Capacity>
+class MpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    MpscQueue()
+    {
+        for (size_t i = 0; i < Capacity; i++)
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    // false when full, the item is not queued
+    bool push(const T &item)
+    {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        Cell *cell;
+        for (;;) {
+            cell = &cells_[pos & (Capacity - 1)];
+            intptr_t diff = (intptr_t)cell->seq.load(std::memory_order_acquire) - (intptr_t)pos;
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                // the consumer did not free it yet
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item = item;
+        cell->seq.store(pos + 1, std::memory_order_release);
+
+        size_t depth = pos + 1 - tail_.load(std::memory_order_relaxed);
+        size_t high = high_water_.load(std::memory_order_relaxed);
+        while (depth > high && !high_water_.compare_exchange_weak(high, depth, std::memory_order_relaxed))
+            ;
+        return true;
+    }
+
+    // false when empty, consumer thread only
+    bool pop(T &item)
+    {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell &cell = cells_[pos & (Capacity - 1)];
+        if (cell.seq.load(std::memory_order_acquire) != pos + 1)
+            return false;
+        item = cell.item;
+        cell.seq.store(pos + Capacity, std::memory_order_release);
+        tail_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // items refused by push() since start
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // most items queued at once since the last call
+    size_t take_high_water() { return high_water_.exchange(0, std::memory_order_relaxed); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> seq;
+        T item;
+    };
+
+    // producer and consumer indices on their own cache lines
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) std::atomic<uint64_t> dropped_{0};
+    std::atomic<size_t> high_water_{0};
+    Cell cells_[Capacity];
+};
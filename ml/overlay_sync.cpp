@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "overlay_sync.h"
+
+#include <cmath>
+#include <cstdio>
+
+// weight of the last result in the latency average
+#define LATENCY_ALPHA 0.1
+// a box moving further than its diagonal between two results is not the same object
+#define MAX_MATCH_DIAGONALS 1.0
+
+static cv::Point2f center(const cv::Rect &box)
+{
+    return cv::Point2f(box.x + box.width / 2.0f, box.y + box.height / 2.0f);
+}
+
+OverlaySync::OverlaySync(int mode, double hold_budget_ms, double compensate_budget_ms)
+    : config_mode_(mode), hold_budget_ms_(hold_budget_ms), compensate_budget_ms_(compensate_budget_ms)
+{
+    // until a latency is measured auto starts live, which is what it used to be
+    mode_ = mode == OVERLAY_AUTO ? OVERLAY_LATEST : mode;
+}
+
+void OverlaySync::published(const Prediction &pred, uint64_t now_us)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+
+    double latency = now_us > pred.timestamp_us ? (now_us - pred.timestamp_us) / 1000.0 : 0;
+    latency_ms_ = latency_ms_ < 0 ? latency : latency_ms_ + LATENCY_ALPHA * (latency - latency_ms_);
+
+    if (have_result_)
+        previous_ = last_;
+    last_ = pred;
+    have_result_ = true;
+
+    update_velocity();
+    select_mode();
+}
+
+void OverlaySync::update_velocity()
+{
+    velocity_.assign(last_.boxes.size(), cv::Point2f(0, 0));
+    if (previous_.timestamp_us == 0 || last_.timestamp_us <= previous_.timestamp_us)
+        return;
+    double dt_ms = (last_.timestamp_us - previous_.timestamp_us) / 1000.0;
+
+    // nearest box of the same class in the previous result
+    std::vector<bool> used(previous_.boxes.size(), false);
+    for (size_t i = 0; i < last_.boxes.size(); i++) {
+        cv::Point2f c = center(last_.boxes[i]);
+        float max_dist = MAX_MATCH_DIAGONALS * std::hypot((float)last_.boxes[i].width,
+                (float)last_.boxes[i].height);
+        int best = -1;
+        float best_dist = 0;
+        for (size_t j = 0; j < previous_.boxes.size(); j++) {
+            if (used[j] || previous_.labels[j] != last_.labels[i])
+                continue;
+            cv::Point2f p = center(previous_.boxes[j]);
+            float dist = std::hypot(c.x - p.x, c.y - p.y);
+            if (dist <= max_dist && (best < 0 || dist < best_dist)) {
+                best = j;
+                best_dist = dist;
+            }
+        }
+        if (best < 0)
+            continue;
+        used[best] = true;
+        cv::Point2f p = center(previous_.boxes[best]);
+        velocity_[i] = cv::Point2f((c.x - p.x) / dt_ms, (c.y - p.y) / dt_ms);
+    }
+}
+
+void OverlaySync::select_mode()
+{
+    if (config_mode_ != OVERLAY_AUTO)
+        return;
+
+    int mode;
+    if (latency_ms_ <= hold_budget_ms_)
+        mode = OVERLAY_HOLD;
+    else if (latency_ms_ <= compensate_budget_ms_)
+        mode = OVERLAY_COMPENSATE;
+    else
+        mode = OVERLAY_LATEST;
+
+    if (mode != mode_) {
+        printf("Overlay %s, result latency %.1f ms \n", overlay_mode_name(mode), latency_ms_);
+        mode_ = mode;
+    }
+}
+
+bool OverlaySync::predict(uint64_t timestamp_us, Prediction &out)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!have_result_)
+        return false;
+
+    out = last_;
+    out.timestamp_us = timestamp_us;
+    if (timestamp_us <= last_.timestamp_us)
+        return true;
+
+    // extrapolating further than the budget would drift more than it corrects
+    double dt_ms = (timestamp_us - last_.timestamp_us) / 1000.0;
+    if (dt_ms > compensate_budget_ms_)
+        dt_ms = compensate_budget_ms_;
+    for (size_t i = 0; i < out.boxes.size(); i++) {
+        out.boxes[i].x += (int)std::lround(velocity_[i].x * dt_ms);
+        out.boxes[i].y += (int)std::lround(velocity_[i].y * dt_ms);
+    }
+    return true;
+}
+
+int OverlaySync::mode()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    return mode_;
+}
+
+double OverlaySync::latency_ms()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    return latency_ms_;
+}
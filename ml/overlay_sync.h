@@ -0,0 +1,51 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ml_config.h"
+#include "yolov4_tflite.h"
+
+/*
+ * Keeps the last results with the time of the frame they describe. In auto
+ * mode the smoothed capture-to-result latency picks the mode: holding the
+ * preview is fine while its delay stays under hold_budget_ms, extrapolating
+ * boxes while the extrapolation stays under compensate_budget_ms, beyond
+ * both the boxes are shown as they are.
+ */
+class OverlaySync
+{
+public:
+    OverlaySync(int mode, double hold_budget_ms, double compensate_budget_ms);
+
+    // result of the frame stamped in pred, now_us on the capture clock
+    void published(const Prediction &pred, uint64_t now_us);
+    // boxes of the last result extrapolated to a frame captured at timestamp_us
+    bool predict(uint64_t timestamp_us, Prediction &out);
+
+    int mode();
+    double latency_ms();
+
+private:
+    std::mutex lock_;
+    int config_mode_;
+    int mode_;
+    double hold_budget_ms_;
+    double compensate_budget_ms_;
+    double latency_ms_ = -1;    // smoothed, negative until the first result
+
+    Prediction last_;
+    Prediction previous_;
+    bool have_result_ = false;
+    std::vector<cv::Point2f> velocity_;     // px per ms of each box of last_
+
+    void update_velocity();
+    void select_mode();
+};
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "roi_scheduler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+// the motion estimate runs on the frame scaled down by this factor
+#define MOTION_SCALE 8
+// weight of the last frame in the activity average
+#define ACTIVITY_ALPHA 0.3
+// plans a region keeps a pending detection as a reason to run again
+#define HIT_MEMORY 4
+// learned regions at most, and full frame periods without hits before dropping one
+#define MAX_LEARNED_ROIS 6
+#define LEARNED_ROI_TTL 3
+// weight of one plan of waiting against one unit of activity
+#define STALENESS_WEIGHT 0.5
+
+RoiScheduler::RoiScheduler(int frame_width, int frame_height, int full_period, int roi_size)
+    : frame_width_(frame_width), frame_height_(frame_height),
+      full_period_(full_period > 0 ? full_period : 1),
+      roi_size_(std::min(roi_size, std::min(frame_width, frame_height)))
+{
+}
+
+cv::Rect RoiScheduler::square_around(const cv::Rect &rect)
+{
+    // square, at least roi_size_ and at most the frame height, the detector pads anything else
+    int side = std::max(std::max(rect.width, rect.height), roi_size_);
+    side = std::min(side, std::min(frame_width_, frame_height_));
+    int x = rect.x + rect.width / 2 - side / 2;
+    int y = rect.y + rect.height / 2 - side / 2;
+    x = std::max(0, std::min(x, frame_width_ - side));
+    y = std::max(0, std::min(y, frame_height_ - side));
+    return cv::Rect(x, y, side, side);
+}
+
+void RoiScheduler::add_roi(const cv::Rect &rect)
+{
+    Roi roi;
+    roi.rect = square_around(rect);
+    roi.learned = false;
+    rois_.push_back(roi);
+}
+
+void RoiScheduler::update_activity(const cv::Mat &frame)
+{
+    cv::Mat small, gray;
+    cv::resize(frame, small, cv::Size(frame.cols / MOTION_SCALE, frame.rows / MOTION_SCALE), 0, 0,
+            cv::INTER_AREA);
+    cv::cvtColor(small, gray, cv::COLOR_RGB2GRAY);
+
+    if (!prev_small_.empty()) {
+        cv::Mat diff;
+        cv::absdiff(gray, prev_small_, diff);
+        for (Roi &roi : rois_) {
+            cv::Rect r(roi.rect.x / MOTION_SCALE, roi.rect.y / MOTION_SCALE,
+                    roi.rect.width / MOTION_SCALE, roi.rect.height / MOTION_SCALE);
+            r &= cv::Rect(0, 0, diff.cols, diff.rows);
+            if (r.empty())
+                continue;
+            double motion = cv::mean(diff(r)).val[0];
+            roi.activity += ACTIVITY_ALPHA * (motion - roi.activity);
+        }
+    }
+    prev_small_ = gray;
+}
+
+cv::Rect RoiScheduler::plan(const cv::Mat &frame, int &index)
+{
+    plans_++;
+    update_activity(frame);
+
+    index = -1;
+    if (rois_.empty() || full_runs_ == 0 || plans_ - last_full_ >= (uint64_t)full_period_)
+        return cv::Rect(0, 0, frame.cols, frame.rows);
+
+    // motion and recent detections pull a region forward, waiting does too so none starves
+    double best_score = 0;
+    for (int i = 0; i < (int)rois_.size(); i++) {
+        const Roi &roi = rois_[i];
+        double score = roi.activity + STALENESS_WEIGHT * (plans_ - roi.last_run);
+        if (roi.hits && plans_ - roi.last_hit <= HIT_MEMORY)
+            score += 2 * STALENESS_WEIGHT * HIT_MEMORY;
+        if (index < 0 || score > best_score) {
+            index = i;
+            best_score = score;
+        }
+    }
+    return rois_[index].rect;
+}
+
+void RoiScheduler::learn(const Prediction &pred)
+{
+    for (const cv::Rect &box : pred.boxes) {
+        cv::Point center(box.x + box.width / 2, box.y + box.height / 2);
+        bool covered = false;
+        for (const Roi &roi : rois_)
+            covered = covered || roi.rect.contains(center);
+        if (covered)
+            continue;
+
+        int learned = std::count_if(rois_.begin(), rois_.end(), [](const Roi &r) { return r.learned; });
+        if (learned >= MAX_LEARNED_ROIS)
+            break;
+        Roi roi;
+        roi.rect = square_around(box);
+        roi.learned = true;
+        roi.last_run = plans_;
+        roi.last_hit = plans_;
+        rois_.push_back(roi);
+    }
+
+    // learned regions that stopped seeing anything go away
+    uint64_t ttl = (uint64_t)LEARNED_ROI_TTL * full_period_;
+    rois_.erase(std::remove_if(rois_.begin(), rois_.end(), [&](const Roi &roi) {
+        return roi.learned && plans_ - roi.last_hit > ttl;
+    }), rois_.end());
+}
+
+void RoiScheduler::report(int index, const cv::Rect &region, const Prediction &pred, Prediction &merged)
+{
+    if (index < 0) {
+        full_runs_++;
+        last_full_ = plans_;
+        last_ = pred;
+        // regions covering a detection count it as theirs
+        for (Roi &roi : rois_) {
+            for (const cv::Rect &box : pred.boxes) {
+                if (roi.rect.contains(cv::Point(box.x + box.width / 2, box.y + box.height / 2)))
+                    roi.last_hit = plans_;
+            }
+        }
+        learn(pred);
+        merged = last_;
+        return;
+    }
+
+    Roi &roi = rois_[index];
+    if (roi.runs)
+        roi.cadence += (plans_ - roi.last_run - roi.cadence) / std::min<uint64_t>(roi.runs, 16);
+    roi.runs++;
+    roi.last_run = plans_;
+    if (!pred.boxes.empty()) {
+        roi.hits++;
+        roi.last_hit = plans_;
+    }
+
+    // boxes of the region replace the ones whose center it covers, the rest stays as last seen
+    Prediction next;
+    next.frame_seq = pred.frame_seq;
+    next.timestamp_us = pred.timestamp_us;
+    for (size_t i = 0; i < last_.boxes.size(); i++) {
+        const cv::Rect &box = last_.boxes[i];
+        if (region.contains(cv::Point(box.x + box.width / 2, box.y + box.height / 2)))
+            continue;
+        next.boxes.push_back(box);
+        next.scores.push_back(last_.scores[i]);
+        next.labels.push_back(last_.labels[i]);
+    }
+    for (size_t i = 0; i < pred.boxes.size(); i++) {
+        next.boxes.push_back(pred.boxes[i] + region.tl());
+        next.scores.push_back(pred.scores[i]);
+        next.labels.push_back(pred.labels[i]);
+    }
+    last_ = next;
+    merged = last_;
+}
+
+std::string RoiScheduler::stats()
+{
+    char line[160];
+    std::string out;
+
+    snprintf(line, sizeof(line), "%llu plans, %llu full frame (every %d)\n",
+            (unsigned long long)plans_, (unsigned long long)full_runs_, full_period_);
+    out += line;
+    snprintf(line, sizeof(line), "%3s  %-7s  %-19s  %8s  %8s  %7s  %8s  %8s\n",
+            "roi", "kind", "rect", "runs", "hits", "hit%", "cadence", "activity");
+    out += line;
+    for (size_t i = 0; i < rois_.size(); i++) {
+        const Roi &roi = rois_[i];
+        char rect[32];
+        snprintf(rect, sizeof(rect), "%d,%d %dx%d", roi.rect.x, roi.rect.y, roi.rect.width, roi.rect.height);
+        snprintf(line, sizeof(line), "%3zu  %-7s  %-19s  %8llu  %8llu  %6.1f%%  %8.1f  %8.2f\n",
+                i, roi.learned ? "learned" : "config", rect, (unsigned long long)roi.runs,
+                (unsigned long long)roi.hits, roi.runs ? 100.0 * roi.hits / roi.runs : 0.0,
+                roi.cadence, roi.activity);
+        out += line;
+    }
+    return out;
+}
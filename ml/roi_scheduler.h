@@ -0,0 +1,69 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+#include "yolov4_tflite.h"
+
+struct Roi
+{
+    cv::Rect rect;
+    bool learned;               // added around a detection, dropped when it stops hitting
+    double activity = 0;        // mean frame difference inside, out of 255
+    uint64_t runs = 0;          // inferences on this region
+    uint64_t hits = 0;          // of which found something
+    uint64_t last_run = 0;      // plan number of the last inference on it
+    uint64_t last_hit = 0;
+    double cadence = 0;         // average plans between two runs
+};
+
+/*
+ * Decides what the next inference runs on. Every full_period plans the whole
+ * frame, otherwise the square region with the most motion, detections or time
+ * since its last run. A region is cropped from the frame as it is, so the
+ * detector's input spends its pixels on the region instead of the fridge walls.
+ * Regions come from ml.conf and are learned around the full frame detections.
+ */
+class RoiScheduler
+{
+public:
+    RoiScheduler(int frame_width, int frame_height, int full_period, int roi_size);
+
+    // a configured region, grown to a square and kept inside the frame
+    void add_roi(const cv::Rect &rect);
+
+    // region for frame, the whole frame or one of rois(), index -1 for the whole frame
+    cv::Rect plan(const cv::Mat &frame, int &index);
+    // result of running the detector on the planned region, boxes in region coordinates;
+    // merged becomes the boxes of the whole frame
+    void report(int index, const cv::Rect &region, const Prediction &pred, Prediction &merged);
+
+    const std::vector<Roi> &rois() const { return rois_; }
+    // one line per region, plus the full frame runs
+    std::string stats();
+
+private:
+    int frame_width_;
+    int frame_height_;
+    int full_period_;
+    int roi_size_;
+    uint64_t plans_ = 0;
+    uint64_t full_runs_ = 0;
+    uint64_t last_full_ = 0;
+    std::vector<Roi> rois_;
+    Prediction last_;           // boxes of the whole frame so far
+    cv::Mat prev_small_;        // downscaled gray frame for the motion estimate
+
+    cv::Rect square_around(const cv::Rect &rect);
+    void update_activity(const cv::Mat &frame);
+    void learn(const Prediction &pred);
+};
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tflite_delegate.h"
+#include "ml_config.h"
+
+#include <cstdio>
+#include <unistd.h>
+
+#include <tensorflow/lite/delegates/external/external_delegate.h>
+#include <tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h>
+#include <tensorflow/lite/version.h>
+
+/*
+ * XNNPACK file backed weight cache (weight_cache_file_path) only exists
+ * from TFLite 2.17, older BSP runtimes build without it. Can be forced
+ * with -DML_XNNPACK_WEIGHT_CACHE=0 or 1.
+ */
+#ifndef ML_XNNPACK_WEIGHT_CACHE
+#if defined(TF_MAJOR_VERSION) && defined(TF_MINOR_VERSION) && \
+    (TF_MAJOR_VERSION > 2 || (TF_MAJOR_VERSION == 2 && TF_MINOR_VERSION >= 17))
+#define ML_XNNPACK_WEIGHT_CACHE 1
+#else
+#define ML_XNNPACK_WEIGHT_CACHE 0
+#endif
+#endif
+
+static const char *vx_delegate_path = "/usr/lib/libvx_delegate.so";
+static const char *ethosu_delegate_path = "/usr/lib/libethosu_delegate.so";
+
+bool apply_tflite_delegate(tflite::Interpreter &interpreter, int npu_tpye, int num_threads,
+        const std::string &cache_prefix, tflite::Interpreter::TfLiteDelegatePtr &delegate,
+        std::string &cache_path)
+{
+    cache_path.clear();
+    switch (npu_tpye) {
+        case ML_DELEGATE_VX:
+        case ML_DELEGATE_ETHOSU:
+        {
+            const char *delegate_path = npu_tpye == ML_DELEGATE_VX ? vx_delegate_path : ethosu_delegate_path;
+            if (access(delegate_path, R_OK) != 0) {
+                printf("%s delegate not found: %s \n", ml_delegate_name(npu_tpye), delegate_path);
+                return false;
+            }
+            auto ext_delegate_option = TfLiteExternalDelegateOptionsDefault(delegate_path);
+            if (npu_tpye == ML_DELEGATE_VX && !cache_prefix.empty()) {
+                // VX keeps the compiled network binary graph, reloaded instead of recompiled
+                cache_path = cache_prefix + ".vx";
+                ext_delegate_option.insert(&ext_delegate_option, "allowed_cache_mode", "true");
+                ext_delegate_option.insert(&ext_delegate_option, "cache_file_path", cache_path.c_str());
+            }
+            delegate = tflite::Interpreter::TfLiteDelegatePtr(
+                    TfLiteExternalDelegateCreate(&ext_delegate_option), TfLiteExternalDelegateDelete);
+        }
+            break;
+        case ML_DELEGATE_XNNPACK:
+        {
+            TfLiteXNNPackDelegateOptions xnnpack_option = TfLiteXNNPackDelegateOptionsDefault();
+            xnnpack_option.num_threads = num_threads;
+#if ML_XNNPACK_WEIGHT_CACHE
+            if (!cache_prefix.empty()) {
+                // packed weights are written on the first boot and mmapped afterwards
+                cache_path = cache_prefix + ".xnnpack";
+                xnnpack_option.weight_cache_file_path = cache_path.c_str();
+            }
+#endif
+            delegate = tflite::Interpreter::TfLiteDelegatePtr(
+                    TfLiteXNNPackDelegateCreate(&xnnpack_option), TfLiteXNNPackDelegateDelete);
+        }
+            break;
+        default:
+            printf("Unknown delegate %d \n", npu_tpye);
+            return false;
+    }
+
+    if (!delegate) {
+        printf("%s delegate backend is unsupported on this platform. \n", ml_delegate_name(npu_tpye));
+        return false;
+    }
+
+    if (interpreter.ModifyGraphWithDelegate(delegate.get()) != kTfLiteOk) {
+        printf("Failed to apply %s delegate. \n", ml_delegate_name(npu_tpye));
+        return false;
+    }
+    printf("Applied %s delegate. \n", ml_delegate_name(npu_tpye));
+    if (!cache_path.empty())
+        printf("%s delegate cache: %s \n", ml_delegate_name(npu_tpye), cache_path.c_str());
+    return true;
+}
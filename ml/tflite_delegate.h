@@ -0,0 +1,21 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+
+#include <tensorflow/lite/interpreter.h>
+
+/*
+ * Applies one of MLDelegate (not CPU or AUTO) to interpreter, delegate must
+ * outlive it.
+ * cache_prefix enables the VX graph and XNNPACK weight caches, cache_path is
+ * set to the file actually used. Reports errors and returns false.
+ */
+bool apply_tflite_delegate(tflite::Interpreter &interpreter, int npu_tpye, int num_threads,
+        const std::string &cache_prefix, tflite::Interpreter::TfLiteDelegatePtr &delegate,
+        std::string &cache_path);
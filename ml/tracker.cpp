@@ -0,0 +1,113 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracker.h"
+
+#include <algorithm>
+
+// side of the thumbnail compared between frames
+#define SIGNATURE_SIZE 4
+// mean absolute difference per channel, out of 255, that counts as a new appearance
+#define APPEARANCE_THRESHOLD 12.0
+
+static float iou(const cv::Rect &a, const cv::Rect &b)
+{
+    int inter = (a & b).area();
+    int uni = a.area() + b.area() - inter;
+    return uni > 0 ? (float)inter / uni : 0.0f;
+}
+
+IouTracker::IouTracker(float iou_threshold, int max_missed)
+    : iou_threshold_(iou_threshold), max_missed_(max_missed)
+{
+}
+
+void IouTracker::compute_signature(Track &track, const cv::Mat &frame)
+{
+    cv::Rect roi = track.box & cv::Rect(0, 0, frame.cols, frame.rows);
+    if (roi.empty()) {
+        track.signature.release();
+        return;
+    }
+    // area averaging over a view of the frame, nothing is copied but the thumbnail
+    cv::resize(frame(roi), track.signature, cv::Size(SIGNATURE_SIZE, SIGNATURE_SIZE), 0, 0, cv::INTER_AREA);
+    // a BGRA frame gives the signature of the same crop in RGB
+    if (track.signature.channels() == 4)
+        cv::cvtColor(track.signature, track.signature, cv::COLOR_BGRA2RGB);
+}
+
+bool IouTracker::appearance_changed(const Track &track)
+{
+    if (track.signature.empty() || track.classified_signature.empty())
+        return true;
+    double diff = cv::norm(track.signature, track.classified_signature, cv::NORM_L1);
+    return diff / (track.signature.total() * track.signature.channels()) > APPEARANCE_THRESHOLD;
+}
+
+void IouTracker::update(const std::vector<cv::Rect> &boxes, const std::vector<int> &labels,
+        const cv::Mat &frame)
+{
+    struct Match
+    {
+        float iou;
+        int track;
+        int detection;
+    };
+    std::vector<Match> matches;
+    for (int t = 0; t < (int)tracks_.size(); t++) {
+        for (int d = 0; d < (int)boxes.size(); d++) {
+            float overlap = iou(tracks_[t].box, boxes[d]);
+            if (overlap >= iou_threshold_)
+                matches.push_back({overlap, t, d});
+        }
+    }
+    std::sort(matches.begin(), matches.end(), [](const Match &a, const Match &b) { return a.iou > b.iou; });
+
+    std::vector<bool> track_used(tracks_.size(), false);
+    std::vector<bool> detection_used(boxes.size(), false);
+    for (const Match &m : matches) {
+        if (track_used[m.track] || detection_used[m.detection])
+            continue;
+        track_used[m.track] = true;
+        detection_used[m.detection] = true;
+
+        Track &track = tracks_[m.track];
+        track.box = boxes[m.detection];
+        track.missed = 0;
+        if (track.detector_label != labels[m.detection])
+            track.stale = true;
+        track.detector_label = labels[m.detection];
+        compute_signature(track, frame);
+        if (appearance_changed(track))
+            track.stale = true;
+    }
+
+    for (int t = 0; t < (int)tracks_.size(); t++) {
+        if (!track_used[t])
+            tracks_[t].missed++;
+    }
+    tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(),
+            [this](const Track &track) { return track.missed > max_missed_; }), tracks_.end());
+
+    for (int d = 0; d < (int)boxes.size(); d++) {
+        if (detection_used[d])
+            continue;
+        Track track;
+        track.id = next_id_++;
+        track.box = boxes[d];
+        track.detector_label = labels[d];
+        compute_signature(track, frame);
+        tracks_.push_back(track);
+    }
+}
+
+void IouTracker::classified(Track &track, int label, float score)
+{
+    track.label = label;
+    track.score = score;
+    track.stale = false;
+    track.signature.copyTo(track.classified_signature);
+}
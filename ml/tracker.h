@@ -0,0 +1,50 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+struct Track
+{
+    int id;
+    cv::Rect box;
+    int detector_label;
+    int missed = 0;             // consecutive frames without a matching detection
+    bool stale = true;          // new or its appearance changed since classified
+    int label = -1;             // second stage result, -1 until classified
+    float score = 0;
+    cv::Mat signature;          // tiny thumbnail of the crop, compared between frames
+    cv::Mat classified_signature;
+};
+
+/*
+ * Greedy IoU association of detections to tracks. A track is marked stale
+ * when it is new, when the detector changes its class or when its crop
+ * drifts away from the one last classified.
+ */
+class IouTracker
+{
+public:
+    IouTracker(float iou_threshold = 0.3f, int max_missed = 5);
+
+    void update(const std::vector<cv::Rect> &boxes, const std::vector<int> &labels, const cv::Mat &frame);
+    // the crop of track was classified as label
+    void classified(Track &track, int label, float score);
+
+    std::vector<Track> &tracks() { return tracks_; }
+
+private:
+    float iou_threshold_;
+    int max_missed_;
+    int next_id_ = 0;
+    std::vector<Track> tracks_;
+
+    void compute_signature(Track &track, const cv::Mat &frame);
+    bool appearance_changed(const Track &track);
+};
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "two_stage_detector.h"
+
+#include <algorithm>
+#include <cstdio>
+
+// weight of the last frame in the per crop cost average
+#define CROP_COST_ALPHA 0.2
+
+TwoStageDetector::TwoStageDetector(const std::string &classifier_path, int npu_tpye, int num_threads,
+        double budget_ms)
+    : budget_ms_(budget_ms)
+{
+    // the classifier is too small to be worth benchmarking delegates for
+    if (npu_tpye == ML_DELEGATE_AUTO)
+        npu_tpye = ML_DELEGATE_CPU;
+    if (!classifier_.load(classifier_path, npu_tpye, num_threads))
+        exit(1);
+}
+
+void TwoStageDetector::run(YOLOV4 &detector, const cv::Mat &frame, Prediction &result)
+{
+    times = {};
+
+    auto t0 = std::chrono::steady_clock::now();
+    Prediction detections;
+    detector.run(frame, detections);
+    auto t1 = std::chrono::steady_clock::now();
+
+    tracker_.update(detections.boxes, detections.labels, frame);
+    auto t2 = std::chrono::steady_clock::now();
+    times.detect_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    times.track_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    // never classified tracks first, they are not shown until they are
+    std::vector<Track *> stale;
+    for (Track &track : tracker_.tracks()) {
+        if (track.stale && track.missed == 0)
+            stale.push_back(&track);
+    }
+    std::stable_sort(stale.begin(), stale.end(), [](const Track *a, const Track *b) {
+        return a->label < 0 && b->label >= 0;
+    });
+
+    // as many crops as fit in what the detector left of the budget, whole batches at first
+    size_t allowed = stale.size();
+    if (budget_ms_ > 0 && !stale.empty()) {
+        double left_ms = budget_ms_ - times.detect_ms - times.track_ms;
+        if (crop_ms_ > 0)
+            allowed = left_ms > 0 ? (size_t)(left_ms / crop_ms_) : 0;
+        else
+            allowed = classifier_.batch();
+        if (allowed == 0 && !over_budget_reported_) {
+            printf("Detector alone takes %.1f ms of the %.1f ms budget, classification deferred \n",
+                    times.detect_ms, budget_ms_);
+            over_budget_reported_ = true;
+        }
+    }
+    if (stale.size() > allowed) {
+        times.deferred = stale.size() - allowed;
+        stale.resize(allowed);
+    }
+
+    // crops are views into the frame, the classifier resizes them into its input
+    std::vector<cv::Mat> crops;
+    std::vector<Track *> cropped;
+    cv::Rect bounds(0, 0, frame.cols, frame.rows);
+    for (Track *track : stale) {
+        cv::Rect roi = track->box & bounds;
+        if (roi.empty())
+            continue;
+        crops.push_back(frame(roi));
+        cropped.push_back(track);
+    }
+
+    if (!crops.empty()) {
+        std::vector<int> labels;
+        std::vector<float> scores;
+        if (classifier_.classify(crops, labels, scores)) {
+            for (size_t i = 0; i < cropped.size(); i++)
+                tracker_.classified(*cropped[i], labels[i], scores[i]);
+        }
+        auto t3 = std::chrono::steady_clock::now();
+        times.classify_ms = std::chrono::duration<double, std::milli>(t3 - t2).count();
+        times.crops = crops.size();
+
+        double per_crop = times.classify_ms / crops.size();
+        crop_ms_ = crop_ms_ > 0 ? crop_ms_ + CROP_COST_ALPHA * (per_crop - crop_ms_) : per_crop;
+    }
+
+    for (const Track &track : tracker_.tracks()) {
+        if (track.label < 0 || track.missed > 0)
+            continue;
+        result.boxes.push_back(track.box);
+        result.scores.push_back(track.score);
+        result.labels.push_back(track.label);
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+
+#include "yolov4_tflite.h"
+#include "freshness_classifier.h"
+#include "tracker.h"
+
+// wall time of each stage of one TwoStageDetector::run()
+struct TwoStageTimes
+{
+    double detect_ms = 0;       // the whole YOLOV4::run() of the fruit detector
+    double track_ms = 0;
+    double classify_ms = 0;     // crops resized into the classifier and its invokes
+    int crops = 0;              // crops classified this frame
+    int deferred = 0;           // stale tracks left for the next frames by the budget
+};
+
+/*
+ * Detect then classify: a small detector localizes the fruit, the classifier
+ * tells its freshness. Only new tracks and tracks whose appearance changed are
+ * classified, so a still scene costs the detector alone. Tracks not yet
+ * classified are left out of the result.
+ */
+class TwoStageDetector
+{
+public:
+    // exits on failure like YOLOV4, budget_ms of 0 classifies every stale track
+    TwoStageDetector(const std::string &classifier_path, int npu_tpye, int num_threads, double budget_ms);
+
+    void run(YOLOV4 &detector, const cv::Mat &frame, Prediction &result);
+
+    int num_classes() const { return classifier_.num_classes(); }
+
+    // stages of the last run()
+    TwoStageTimes times;
+
+private:
+    FreshnessClassifier classifier_;
+    IouTracker tracker_;
+    double budget_ms_;
+    double crop_ms_ = 0;        // moving average of the classifier cost per crop
+    bool over_budget_reported_ = false;
+};
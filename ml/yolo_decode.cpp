@@ -0,0 +1,64 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "yolo_decode.h"
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+typedef void (*decode_fn)(const DecodeParams &p, DecodeOutput &out);
+
+template <int NumClasses>
+static decode_fn select_kernel(BoxFormat format, TensorLayout layout)
+{
+    if (format == BOX_XYWH)
+        return layout == LAYOUT_ANCHOR_FIRST ? yolo_decode<NumClasses, BOX_XYWH, LAYOUT_ANCHOR_FIRST>
+                                             : yolo_decode<NumClasses, BOX_XYWH, LAYOUT_CLASS_FIRST>;
+    return layout == LAYOUT_ANCHOR_FIRST ? yolo_decode<NumClasses, BOX_XYXY, LAYOUT_ANCHOR_FIRST>
+                                         : yolo_decode<NumClasses, BOX_XYXY, LAYOUT_CLASS_FIRST>;
+}
+
+void yolo_decode_dispatch(const DecodeParams &p, BoxFormat format, TensorLayout layout, DecodeOutput &out)
+{
+    decode_fn fn;
+
+    // class counts of the models shipped or likely to be, 0 is the generic runtime loop
+    switch (p.num_classes) {
+        case 1:  fn = select_kernel<1>(format, layout); break;
+        case 2:  fn = select_kernel<2>(format, layout); break;
+        case 3:  fn = select_kernel<3>(format, layout); break;
+        case 9:  fn = select_kernel<9>(format, layout); break;
+        case 80: fn = select_kernel<80>(format, layout); break;
+        default: fn = select_kernel<0>(format, layout); break;
+    }
+
+    out.boxes.reserve(64);
+    out.scores.reserve(64);
+    out.class_ids.reserve(64);
+    fn(p, out);
+}
+
+bool any_score_above(const float *scores, size_t n, float threshold)
+{
+    size_t i = 0;
+#if defined(__aarch64__)
+    float32x4_t t = vdupq_n_f32(threshold);
+    for (; i + 16 <= n; i += 16) {
+        uint32x4_t a = vcgtq_f32(vld1q_f32(scores + i), t);
+        uint32x4_t b = vcgtq_f32(vld1q_f32(scores + i + 4), t);
+        uint32x4_t c = vcgtq_f32(vld1q_f32(scores + i + 8), t);
+        uint32x4_t d = vcgtq_f32(vld1q_f32(scores + i + 12), t);
+        if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))))
+            return true;
+    }
+#endif
+    for (; i < n; i++) {
+        if (scores[i] > threshold)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+#include "ml_config.h"
+
+struct DecodeParams
+{
+    const float *boxes;     // 4 values per anchor
+    const float *scores;    // num_classes values per anchor
+    int num_anchors;
+    int num_classes;
+    float scale_x;          // input pixels to frame pixels
+    float scale_y;
+    float threshold;        // candidates at or below it are dropped before NMS
+};
+
+struct DecodeOutput
+{
+    std::vector<cv::Rect> boxes;
+    std::vector<float> scores;
+    std::vector<int> class_ids;
+};
+
+/*
+ * Best class of every anchor, boxes scaled to the frame. With the class count
+ * and layout known at compile time the class loop unrolls and the class-first
+ * path runs over contiguous anchors, which the compiler vectorizes.
+ */
+template <int NumClasses, BoxFormat Format, TensorLayout Layout>
+void yolo_decode(const DecodeParams &p, DecodeOutput &out)
+{
+    const int n = p.num_anchors;
+    const int classes = NumClasses > 0 ? NumClasses : p.num_classes;
+
+    auto emit = [&](int i, float score, int class_id) {
+        float v[4];
+        for (int k = 0; k < 4; k++)
+            v[k] = Layout == LAYOUT_ANCHOR_FIRST ? p.boxes[i * 4 + k] : p.boxes[k * n + i];
+
+        float xmin, ymin, xmax, ymax;
+        if (Format == BOX_XYWH) {
+            xmin = v[0] - v[2] / 2.0f;
+            ymin = v[1] - v[3] / 2.0f;
+            xmax = v[0] + v[2] / 2.0f;
+            ymax = v[1] + v[3] / 2.0f;
+        } else {
+            xmin = v[0];
+            ymin = v[1];
+            xmax = v[2];
+            ymax = v[3];
+        }
+        xmin *= p.scale_x;
+        xmax *= p.scale_x;
+        ymin *= p.scale_y;
+        ymax *= p.scale_y;
+
+        out.boxes.push_back(cv::Rect((int)xmin, (int)ymin, (int)(xmax - xmin), (int)(ymax - ymin)));
+        out.scores.push_back(score);
+        out.class_ids.push_back(class_id);
+    };
+
+    if (Layout == LAYOUT_ANCHOR_FIRST) {
+        for (int i = 0; i < n; i++) {
+            const float *s = p.scores + i * classes;
+            float score = 0.0f;
+            int class_id = 0;
+            for (int j = 0; j < classes; j++) {
+                if (s[j] > score) {
+                    class_id = j;
+                    score = s[j];
+                }
+            }
+            if (score > p.threshold)
+                emit(i, score, class_id);
+        }
+    } else {
+        // running max over the class rows, each row is contiguous in anchors
+        std::vector<float> best(n, 0.0f);
+        std::vector<int> best_id(n, 0);
+        for (int j = 0; j < classes; j++) {
+            const float *row = p.scores + j * n;
+            for (int i = 0; i < n; i++) {
+                bool better = row[i] > best[i];
+                best[i] = better ? row[i] : best[i];
+                best_id[i] = better ? j : best_id[i];
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            if (best[i] > p.threshold)
+                emit(i, best[i], best_id[i]);
+        }
+    }
+}
+
+// specialized kernel when one matches the class count, runtime loop otherwise
+void yolo_decode_dispatch(const DecodeParams &p, BoxFormat format, TensorLayout layout, DecodeOutput &out);
+
+/*
+ * Whether any of n scores is above threshold, 16 at a time with NEON. It stops
+ * at the first block that is, so a scene with objects costs little more than
+ * its first anchors and an empty one a single pass without decoding anything.
+ */
+bool any_score_above(const float *scores, size_t n, float threshold);
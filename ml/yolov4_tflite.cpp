@@ -7,58 +7,80 @@
 # SPDX-License-Identifier:    Apache-2.0
 ==============================================================================*/
 #include "yolov4_tflite.h"
+#include "tflite_delegate.h"
 
 #include <tensorflow/lite/model.h>
 #include <tensorflow/lite/interpreter.h>
 
-#define CLASS_NUM 9
+#include <algorithm>
+#include <type_traits>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
 
-std::string labelNames[CLASS_NUM] = {
+// timed invokes per candidate when the delegate is picked automatically
+#define DELEGATE_BENCH_RUNS 5
+
+// custom tensor allocations must be aligned like TFLite's own, kDefaultTensorAlignment
+#define TENSOR_ALIGNMENT 64
+
+// profiler events kept per invoke, well above the node count of the detector
+#define PROFILE_MAX_EVENTS 1024
+
+// classes of the shipped freshness model, used when no label file is installed
+static const char *default_labels[] = {
     "fresh_apple", "normal_apple", "rotten_apple", "fresh_banana", "normal_banana",
     "rotten_banana", "fresh_orange", "normal_orange", "rotten_orange"
 };
 
-YOLOV4::YOLOV4(const std::string model_path, int npu_tpye, int num_threads)
+YOLOV4::YOLOV4()
+    : delegate_(nullptr, [](TfLiteDelegate *) {})
 {
+    start_time_ = std::chrono::steady_clock::now();
+
     // configs init
     confThreshold = 0.5;
     nmsThreshold = 0.5;
-    nthreads = 4;
-    npu_tpye = 2;
+    box_format = BOX_XYWH;
+    nthreads = 1;
+    npu_tpye = ML_DELEGATE_CPU;
+}
+
+YOLOV4::YOLOV4(const std::string model_path, int npu_tpye, int num_threads)
+    : YOLOV4()
+{
+    if (!load(model_path, npu_tpye, num_threads))
+        exit(1);
+}
+
+bool YOLOV4::load(const std::string model_path, int npu_tpye, int num_threads)
+{
+    nthreads = num_threads > 0 ? num_threads : 1;
+    model_path_ = model_path;
 
     // load model
     std::ifstream file(model_path);
     if (!file) {
         printf("Failed to open %s \n", model_path.c_str());
-        exit(1);
+        return false;
     }
     model_ = tflite::FlatBufferModel::BuildFromFile(model_path.c_str());
     if (!model_) {
        printf ("Failed to mmap model %s \n", model_path.c_str());
-        exit(1);
-    }
-
-    // create interpreter
-    tflite::ops::builtin::BuiltinOpResolver resolver;
-    tflite::InterpreterBuilder(*model_, resolver)(&interpreter_);
-    if (!interpreter_) {
-        printf ("Failed to construct TFLite interpreter");
-        exit(1);
+        return false;
     }
+    init_cache_prefix();
 
-    // add npu delegate
-    if ( npu_tpye ) {
-        apply_delegate(npu_tpye);
-    } else {
-        interpreter_->SetNumThreads(num_threads);
-    }
+    // create interpreter and apply the delegate
+    if (npu_tpye == ML_DELEGATE_AUTO)
+        npu_tpye = select_delegate(nthreads);
+    this->npu_tpye = npu_tpye;
 
-    // alloc tensor
-    TfLiteStatus status = interpreter_->AllocateTensors();
-    if (status != kTfLiteOk)
-    {
-        printf ("Failed to allocate the memory for tensors. \n");
-        exit(1);
+    if (!build_interpreter(npu_tpye, nthreads)) {
+        printf ("Failed to set up %s interpreter for %s \n",
+                ml_delegate_name(npu_tpye), model_path.c_str());
+        return false;
     }
 
     // input information
@@ -76,52 +98,203 @@ YOLOV4::YOLOV4(const std::string model_path, int npu_tpye, int num_threads)
         _input_u8 = interpreter_->typed_tensor<uint8_t>(input);
     } else {
         std::cout << "YOLO Model Input type donot support yet\n";
-        exit(0);
+        return false;
     }
 
     std::cout << "YOLO Model Input Shape:[1][" << in_height << "][" <<in_width
             << "][" << in_channels << "]\n";
+
+    // output information, scores then boxes, each [1][anchors][n] or [1][n][anchors]
+    TfLiteTensor *score_tensor = interpreter_->tensor(interpreter_->outputs()[0]);
+    TfLiteTensor *box_tensor = interpreter_->tensor(interpreter_->outputs()[1]);
+    if (score_tensor->type != kTfLiteFloat32 || box_tensor->type != kTfLiteFloat32 ||
+        score_tensor->dims->size != 3 || box_tensor->dims->size != 3) {
+        std::cout << "YOLO Model Output type donot support yet\n";
+        return false;
+    }
+    if (box_tensor->dims->data[2] == 4) {
+        layout_ = LAYOUT_ANCHOR_FIRST;
+        num_anchors_ = box_tensor->dims->data[1];
+        num_classes_ = score_tensor->dims->data[2];
+    } else if (box_tensor->dims->data[1] == 4) {
+        layout_ = LAYOUT_CLASS_FIRST;
+        num_anchors_ = box_tensor->dims->data[2];
+        num_classes_ = score_tensor->dims->data[1];
+    } else {
+        std::cout << "YOLO Model Output layout donot support yet\n";
+        return false;
+    }
+
+    std::cout << "YOLO Model Output: " << num_anchors_ << " anchors, " << num_classes_ << " classes, "
+            << (layout_ == LAYOUT_ANCHOR_FIRST ? "anchor" : "class") << " first\n";
+    return true;
+}
+
+void YOLOV4::getLabelsName(std::string path, std::vector<std::string> &labelNames)
+{
+    labelNames.clear();
+
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t end = line.find_last_not_of(" \t\r");
+        if (end == std::string::npos)
+            continue;
+        labelNames.push_back(line.substr(0, end + 1));
+    }
+
+    if (labelNames.empty()) {
+        printf("No labels in %s, using the freshness classes \n", path.c_str());
+        labelNames.assign(default_labels, default_labels + sizeof(default_labels) / sizeof(default_labels[0]));
+    }
+    labels_ = labelNames;
 }
 
 YOLOV4::~YOLOV4() {}
 
-void YOLOV4::apply_delegate(int npu_tpye)
+static uint64_t fnv1a_64(const uint8_t *data, size_t size)
 {
-    // assume TFLite v2.0 or newer
-    std::map<std::string, tflite::Interpreter::TfLiteDelegatePtr> delegates;
-    std::string delegate_path;
-    switch (npu_tpye){
-        case 1:
-            break;
-        case 2:
-        {
-            printf("NPU type: ethou-u65 \n");
-            delegate_path = "/usr/lib/libethosu_delegate.so";
-        }
-            break;
-        default:
-            break;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
     }
+    return hash;
+}
 
-    auto ext_delegate_option =
-                    TfLiteExternalDelegateOptionsDefault(delegate_path.c_str());
-    auto ext_delegate_ptr = TfLiteExternalDelegateCreate(&ext_delegate_option);
-    auto delegate = tflite::Interpreter::TfLiteDelegatePtr(ext_delegate_ptr, [](TfLiteDelegate*) {});
-    if (!delegate) {
-      printf("delegate backend is unsupported on this platform.");
-    } else {
-      delegates.emplace("IMX NPU", std::move(delegate));
+void YOLOV4::init_cache_prefix()
+{
+    const tflite::Allocation *allocation = model_->allocation();
+    if (!allocation || !allocation->base()) {
+        return;
     }
 
-    for (const auto& delegate : delegates) {
-        if (interpreter_->ModifyGraphWithDelegate(delegate.second.get()) != kTfLiteOk) {
-            printf("Failed to apply %s delegate.", delegate.first.c_str());
-            exit(1);
-        } else {
-                printf("Applied %s delegate. \n", delegate.first.c_str());
+    size_t slash = model_path_.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : model_path_.substr(0, slash);
+    std::string name = slash == std::string::npos ? model_path_ : model_path_.substr(slash + 1);
+    size_t ext = name.rfind(".tflite");
+    if (ext != std::string::npos)
+        name.erase(ext);
+
+    std::string cache_dir = dir + "/cache";
+    if (mkdir(cache_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+        printf("Model cache disabled, cannot create %s: %s \n", cache_dir.c_str(), strerror(errno));
+        return;
+    }
+
+    // key on the content so that replacing the model invalidates the cache
+    char hash[17];
+    snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)fnv1a_64(
+            (const uint8_t *)allocation->base(), allocation->bytes()));
+    cache_prefix_ = cache_dir + "/" + name + "-" + hash;
+}
+
+bool YOLOV4::build_interpreter(int npu_tpye, int num_threads)
+{
+    // drop a previous attempt, the interpreter goes first since it uses the delegate
+    interpreter_.reset();
+    delegate_.reset();
+
+    // no default delegates, so that "cpu" really runs the builtin kernels
+    tflite::ops::builtin::BuiltinOpResolverWithoutDefaultDelegates resolver;
+    tflite::InterpreterBuilder(*model_, resolver)(&interpreter_);
+    if (!interpreter_) {
+        printf ("Failed to construct TFLite interpreter \n");
+        return false;
+    }
+    interpreter_->SetNumThreads(num_threads);
+    if (profiler_)
+        interpreter_->SetProfiler(profiler_.get());
+
+    if (npu_tpye != ML_DELEGATE_CPU && !apply_delegate(npu_tpye, num_threads))
+        return false;
+
+    // alloc tensor
+    TfLiteStatus status = interpreter_->AllocateTensors();
+    if (status != kTfLiteOk)
+    {
+        printf ("Failed to allocate the memory for tensors. \n");
+        return false;
+    }
+    return true;
+}
+
+bool YOLOV4::apply_delegate(int npu_tpye, int num_threads)
+{
+    return apply_tflite_delegate(*interpreter_, npu_tpye, num_threads, cache_prefix_, delegate_,
+            delegate_cache_path_);
+}
+
+int YOLOV4::select_delegate(int num_threads)
+{
+    // the winner is keyed on the model content, so a model replaced in place is benchmarked again
+    std::string choice_path = cache_prefix_.empty() ? "" : cache_prefix_ + ".delegate";
+    std::ifstream choice_in(choice_path);
+    std::string name;
+    if (!choice_path.empty() && choice_in >> name) {
+        int delegate = ml_delegate_from_string(name);
+        if (delegate >= 0 && delegate != ML_DELEGATE_AUTO) {
+            printf("Using %s delegate from %s \n", name.c_str(), choice_path.c_str());
+            return delegate;
+        }
+    }
+
+    const int candidates[] = {ML_DELEGATE_ETHOSU, ML_DELEGATE_VX, ML_DELEGATE_XNNPACK, ML_DELEGATE_CPU};
+    int best = -1;
+    double best_ms = 0;
+
+    for (int delegate : candidates) {
+        if (!build_interpreter(delegate, num_threads))
+            continue;
+
+        // the first invoke pays for lazy initialization, keep it out of the timing
+        if (interpreter_->Invoke() != kTfLiteOk)
+            continue;
+
+        bool ok = true;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < DELEGATE_BENCH_RUNS && ok; i++)
+            ok = interpreter_->Invoke() == kTfLiteOk;
+        if (!ok)
+            continue;
+        double ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count() / DELEGATE_BENCH_RUNS;
+
+        printf("%s delegate: %.2f ms per inference \n", ml_delegate_name(delegate), ms);
+        if (best < 0 || ms < best_ms) {
+            best = delegate;
+            best_ms = ms;
         }
     }
 
+    if (best < 0) {
+        printf("No usable delegate for %s \n", model_path_.c_str());
+        return ML_DELEGATE_CPU;
+    }
+
+    printf("Selected %s delegate \n", ml_delegate_name(best));
+    if (choice_path.empty())
+        return best;
+    std::ofstream choice_out(choice_path);
+    if (choice_out)
+        choice_out << ml_delegate_name(best) << "\n";
+    else
+        printf("Failed to save delegate choice to %s \n", choice_path.c_str());
+    return best;
+}
+
+bool YOLOV4::warmup()
+{
+    // a blank camera sized frame through the whole pipeline, without exiting on failure
+    cv::Mat frame = cv::Mat::zeros(480, 640, CV_8UC3);
+    cv::Mat padded_frame, resized_frame;
+    preprocess(frame, padded_frame, resized_frame);
+    if (in_type == kTfLiteFloat32) {
+      seed_data(_input_f32, resized_frame);
+    } else if (in_type == kTfLiteUInt8) {
+      seed_data(_input_u8, resized_frame);
+    }
+    return interpreter_->Invoke() == kTfLiteOk;
 }
 
 void YOLOV4::run(cv::Mat frame, Prediction &result)
@@ -133,6 +306,8 @@ void YOLOV4::run(cv::Mat frame, Prediction &result)
       exit(-1);
     }
 
+    auto t0 = std::chrono::steady_clock::now();
+
     // preprocess
     cv::Mat padded_frame, resized_frame;
     preprocess(frame, padded_frame, resized_frame);
@@ -143,14 +318,78 @@ void YOLOV4::run(cv::Mat frame, Prediction &result)
     } else if (in_type == kTfLiteUInt8) {
       seed_data(_input_u8, resized_frame);
     }
+    auto t1 = std::chrono::steady_clock::now();
+
+    infer(result, t0, t1);
+}
+
+bool YOLOV4::bind_input(void *data, size_t bytes)
+{
+    // only a byte tensor can take the buffer as it is, float ones need the normalization
+    if (in_type != kTfLiteUInt8)
+        return false;
+    TfLiteTensor *tensor = interpreter_->tensor(input);
+    if (tensor->data.raw == data)
+        return true;
+    if (bytes < tensor->bytes || (uintptr_t)data % TENSOR_ALIGNMENT != 0)
+        return false;
+
+    TfLiteCustomAllocation allocation = {data, tensor->bytes};
+    if (interpreter_->SetCustomAllocationForTensor(input, allocation) != kTfLiteOk ||
+        interpreter_->AllocateTensors() != kTfLiteOk) {
+        printf("Input tensor cannot be bound to an external buffer \n");
+        return false;
+    }
+    _input_u8 = interpreter_->typed_tensor<uint8_t>(input);
+    return true;
+}
+
+void YOLOV4::seed_input(const cv::Mat &resized_frame)
+{
+    cv::Mat src = resized_frame;
+    if (in_type == kTfLiteFloat32) {
+      seed_data(_input_f32, src);
+    } else if (in_type == kTfLiteUInt8) {
+      seed_data(_input_u8, src);
+    }
+}
 
+void YOLOV4::run_prepared(int frame_width, int frame_height, Prediction &result, double preprocess_ms)
+{
+    // letterboxed like preprocess(): padded at the bottom to a square of the frame width
+    padded_img_width = frame_width;
+    padded_img_height = std::max(frame_width, frame_height);
+
+    auto t1 = std::chrono::steady_clock::now();
+    infer(result, t1, t1);
+    times.preprocess_ms = preprocess_ms;
+}
+
+void YOLOV4::infer(Prediction &result, std::chrono::steady_clock::time_point t0,
+        std::chrono::steady_clock::time_point t1)
+{
     // Inference
+    if (profiler_)
+        profiler_->StartProfiling();
     TfLiteStatus status = interpreter_->Invoke();
     if (status != kTfLiteOk)
     {
         std::cout << "\nFailed to run inference!!\n";
         exit(1);
     }
+    auto t2 = std::chrono::steady_clock::now();
+    if (profiler_) {
+        profiler_->StopProfiling();
+        collect_profile(std::chrono::duration<double, std::milli>(t2 - t1).count());
+    }
+
+    if (first_run_) {
+        first_run_ = false;
+        double ttfi_ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start_time_).count();
+        printf("YOLO time to first inference: %.1f ms (%s delegate) \n",
+                ttfi_ms, ml_delegate_name(npu_tpye));
+    }
 
     // get output
     TfLiteTensor* output_locations = nullptr;
@@ -163,50 +402,142 @@ void YOLOV4::run(cv::Mat frame, Prediction &result)
     // auto scores = output_scores->data.f;
 
     output_scores = interpreter_->tensor(interpreter_->outputs()[0]);
-    auto scores = output_scores->data.f;
-
     output_locations = interpreter_->tensor(interpreter_->outputs()[1]);
-    auto output_data = output_locations->data.f;
-
-    std::vector<cv::Rect> objects;
-    std::vector<float> score_vec;
-    std::vector<int> class_ids;
-
-    int box_nums = output_locations->dims->data[1];
-
-    for(int i = 0; i < box_nums; i++) {
-        auto xmin = (output_data[i * 4] - output_data[i * 4 + 2] / 2.0) / in_width * padded_img_width;
-        auto ymin = (output_data[i * 4 + 1] - output_data[i * 4 + 3] / 2.0) / in_height * padded_img_height;
-        auto xmax = (output_data[i * 4] + output_data[i * 4 + 2] / 2.0) / in_width * padded_img_width;
-        auto ymax = (output_data[i * 4 + 1] + output_data[i * 4 + 3] / 2.0) / in_height * padded_img_height;
-        auto width = xmax - xmin;
-        auto height = ymax - ymin;
-
-		float score = 0.0f;
-		int class_num = 0;
-	    for(int j = 0; j < CLASS_NUM; j++){
-			if(scores[j + i * CLASS_NUM] > score){
-				class_num = j;
-				score = scores[j + i * CLASS_NUM];
-			}
-		}
-
-        class_ids.push_back(class_num);
-        score_vec.push_back(score);
-        objects.push_back(cv::Rect(xmin, ymin, width, height));
-	}
-
-	std::vector<int> indices;
-	cv::dnn::NMSBoxes(objects, score_vec, confThreshold, nmsThreshold, indices);
-
-
-
-	for (size_t i = 0; i < indices.size(); ++i) {
-		int idx = indices[i];
-        result.boxes.push_back(objects[idx]);
-        result.scores.push_back(score_vec[idx]);
-        result.labels.push_back(class_ids[idx]);
-	}
+
+    // the empty fridge is the common case, nothing to decode when no score passes
+    times.empty = !any_score_above(output_scores->data.f, (size_t)num_anchors_ * num_classes_,
+            confThreshold);
+
+    DecodeParams params;
+    params.scores = output_scores->data.f;
+    params.boxes = output_locations->data.f;
+    params.num_anchors = num_anchors_;
+    params.num_classes = num_classes_;
+    params.scale_x = (float)padded_img_width / in_width;
+    params.scale_y = (float)padded_img_height / in_height;
+    params.threshold = confThreshold;
+
+    DecodeOutput decoded;
+    if (!times.empty)
+        yolo_decode_dispatch(params, box_format, layout_, decoded);
+    auto t3 = std::chrono::steady_clock::now();
+
+    std::vector<int> indices;
+    if (!times.empty)
+        cv::dnn::NMSBoxes(decoded.boxes, decoded.scores, confThreshold, nmsThreshold, indices);
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        int idx = indices[i];
+        result.boxes.push_back(decoded.boxes[idx]);
+        result.scores.push_back(decoded.scores[idx]);
+        result.labels.push_back(decoded.class_ids[idx]);
+    }
+    auto t4 = std::chrono::steady_clock::now();
+
+    times.preprocess_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    times.invoke_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    times.decode_ms = std::chrono::duration<double, std::milli>(t3 - t2).count();
+    times.nms_ms = std::chrono::duration<double, std::milli>(t4 - t3).count();
+    times.full_copies = frame_copies_;
+    times.input_copies = input_copies_;
+    frame_copies_ = 0;
+    input_copies_ = 0;
+}
+
+void YOLOV4::set_profiling(bool enable)
+{
+    if (enable == profiling())
+        return;
+
+    if (enable) {
+        profiler_.reset(new tflite::profiling::BufferedProfiler(PROFILE_MAX_EVENTS));
+        interpreter_->SetProfiler(profiler_.get());
+    } else {
+        interpreter_->SetProfiler(nullptr);
+        profiler_.reset();
+    }
+    reset_profile();
+}
+
+void YOLOV4::reset_profile()
+{
+    std::lock_guard<std::mutex> guard(profile_lock_);
+    node_profile_.clear();
+    profiled_invokes_ = 0;
+    profiled_invoke_ms_ = 0;
+}
+
+void YOLOV4::collect_profile(double invoke_ms)
+{
+    std::lock_guard<std::mutex> guard(profile_lock_);
+
+    for (const auto *event : profiler_->GetProfileEvents()) {
+        bool in_delegate = event->event_type ==
+                tflite::Profiler::EventType::DELEGATE_OPERATOR_INVOKE_EVENT;
+        if (event->event_type != tflite::Profiler::EventType::OPERATOR_INVOKE_EVENT && !in_delegate)
+            continue;
+
+        int node = (int)event->event_metadata;
+        NodeProfile &entry = node_profile_[std::make_pair((int)in_delegate, node)];
+        if (entry.calls == 0) {
+            entry.name = event->tag ? event->tag : "?";
+            if (in_delegate) {
+                entry.kind = "in-delegate";
+            } else {
+                // a node owned by a delegate is a whole partition, anything else fell back to the CPU
+                auto *node_reg = interpreter_->node_and_registration(node);
+                entry.kind = node_reg && node_reg->first.delegate ? "delegate" : "cpu";
+            }
+        }
+        entry.calls++;
+        entry.total_us += event->elapsed_time;
+        if (event->elapsed_time > entry.max_us)
+            entry.max_us = event->elapsed_time;
+    }
+    profiled_invokes_++;
+    profiled_invoke_ms_ += invoke_ms;
+    profiler_->Reset();
+}
+
+std::string YOLOV4::profile_summary()
+{
+    std::lock_guard<std::mutex> guard(profile_lock_);
+    std::vector<const std::pair<const std::pair<int, int>, NodeProfile> *> rows;
+    double cpu_ms = 0;
+    int cpu_nodes = 0;
+    char line[160];
+    std::string out;
+
+    for (const auto &entry : node_profile_) {
+        rows.push_back(&entry);
+        if (strcmp(entry.second.kind, "cpu") == 0) {
+            cpu_ms += entry.second.total_us / 1000.0;
+            cpu_nodes++;
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto *a, const auto *b) {
+        return a->second.total_us > b->second.total_us;
+    });
+
+    double invoke_avg_ms = profiled_invokes_ ? profiled_invoke_ms_ / profiled_invokes_ : 0;
+    snprintf(line, sizeof(line), "%s delegate, %llu invokes, %.3f ms per invoke, "
+            "%d nodes on CPU taking %.1f%%\n", ml_delegate_name(npu_tpye),
+            (unsigned long long)profiled_invokes_, invoke_avg_ms, cpu_nodes,
+            profiled_invoke_ms_ > 0 ? 100.0 * cpu_ms / profiled_invoke_ms_ : 0.0);
+    out += line;
+    snprintf(line, sizeof(line), "%5s  %-11s  %-28s  %7s  %9s  %9s  %6s\n",
+            "node", "kind", "op", "calls", "avg_ms", "max_ms", "share");
+    out += line;
+
+    for (const auto *row : rows) {
+        const NodeProfile &p = row->second;
+        snprintf(line, sizeof(line), "%5d  %-11s  %-28.28s  %7llu  %9.3f  %9.3f  %5.1f%%\n",
+                row->first.second, p.kind, p.name.c_str(), (unsigned long long)p.calls,
+                p.total_us / 1000.0 / p.calls, p.max_us / 1000.0,
+                profiled_invoke_ms_ > 0 ? 100.0 * p.total_us / 1000.0 / profiled_invoke_ms_ : 0.0);
+        out += line;
+    }
+    return out;
 }
 
 void YOLOV4::preprocess(cv::Mat image, cv::Mat & padded_image, cv::Mat& resized_image)
@@ -218,6 +549,8 @@ void YOLOV4::preprocess(cv::Mat image, cv::Mat & padded_image, cv::Mat& resized_
   // pad
   cv::copyMakeBorder(image, padded_image, 0, pad_bottom, 0, pad_right, cv::BORDER_CONSTANT, cv::Scalar(0, 0, 0));
   cv::resize(padded_image, resized_image, cv::Size(in_height,in_width), cv::INTER_CUBIC);
+  frame_copies_++;
+  input_copies_++;
 }
 
 template <typename T>
@@ -226,11 +559,17 @@ void YOLOV4::seed_data(T *in, cv::Mat &src)
     if (in != NULL && src.data != NULL) {
       uchar *ptr = src.data;
       for (int i = 0; i < src.rows; i++) {
-        for (int j = 0; j < src.cols * 3; j++) {
-          in[i * src.cols * 3 + j] = ((T)(ptr[j]) - _mean) / _std;
+        // a uint8 model takes the raw bytes like a bound input, only float ones are normalized
+        if (std::is_same<T, uint8_t>::value) {
+          memcpy(&in[i * src.cols * 3], ptr, src.cols * 3);
+        } else {
+          for (int j = 0; j < src.cols * 3; j++) {
+            in[i * src.cols * 3 + j] = ((T)(ptr[j]) - _mean) / _std;
+          }
         }
         ptr += src.step;
       }
+      input_copies_++;
     } else {
       std::cout << "input image or input tensor is empty!\n";
       std::cout << __FILE__ << ": " << __LINE__ << std::endl;
@@ -244,7 +583,8 @@ void YOLOV4::draw_img(int classId, float conf, int left, int top, int right, int
 
   std::string label = cv::format("%.2f", conf);
 
-  label = labelNames[classId] + ":" + label;
+  if (classId >= 0 && classId < (int)labels_.size())
+    label = labels_[classId] + ":" + label;
 
 
   int baseLine;
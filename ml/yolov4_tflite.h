@@ -14,44 +14,130 @@
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <map>
+#include <mutex>
 
 #include <tensorflow/lite/model.h>
 #include <tensorflow/lite/interpreter.h>
 #include <tensorflow/lite/kernels/register.h>
 #include <tensorflow/lite/delegates/external/external_delegate.h>
+#include <tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h>
+#include <tensorflow/lite/profiling/buffered_profiler.h>
 
 #include <opencv2/opencv.hpp>
 
+#include "ml_config.h"
+#include "yolo_decode.h"
 
 struct Prediction
 {
     std::vector<cv::Rect> boxes;
     std::vector<float> scores;
     std::vector<int> labels;
+    uint64_t frame_seq = 0;     // camera frame the boxes describe
+    uint64_t timestamp_us = 0;  // its capture time, CLOCK_MONOTONIC
+};
+
+// wall time of each stage of one YOLOV4::run()
+struct StageTimes
+{
+    double preprocess_ms = 0;   // pad, resize and fill the input tensor
+    double invoke_ms = 0;
+    double decode_ms = 0;       // output tensors to boxes, scores and classes
+    double nms_ms = 0;
+    int full_copies = 0;        // frame sized copies made on the CPU to fill the input
+    int input_copies = 0;       // input tensor sized ones
+    bool empty = false;         // no score above the threshold, decode and NMS skipped
 };
 
 class YOLOV4
 {
 public:
+    // npu_tpye is one of MLDelegate, ML_DELEGATE_AUTO benchmarks the usable ones
     YOLOV4(const std::string model, int npu_tpye, int num_threads);
+    // empty instance for load(), which reports errors instead of exiting
+    YOLOV4();
     ~YOLOV4();
 
+    bool load(const std::string model, int npu_tpye, int num_threads);
+    // one inference on a blank frame, false if the interpreter cannot run
+    bool warmup();
+
     void run(cv::Mat frame, Prediction &result);
+
+    /*
+     * For callers producing the input layout themselves, e.g. with G2D: the
+     * frame letterboxed at the top of an input sized RGB image. bind_input()
+     * makes a buffer the input tensor so nothing is copied, false if this
+     * model cannot use it; seed_input() copies into the tensor otherwise.
+     */
+    bool bind_input(void *data, size_t bytes);
+    void seed_input(const cv::Mat &resized_frame);
+    void run_prepared(int frame_width, int frame_height, Prediction &result, double preprocess_ms);
+    // frame sized copies the caller made on the CPU for the next inference, e.g. to hold the frame
+    void count_frame_copies(int copies) { frame_copies_ += copies; }
+    int input_width() const { return in_width; }
+    int input_height() const { return in_height; }
+    // one class name per line, the built-in freshness classes when the file is missing
     void getLabelsName(std::string path, std::vector<std::string> &labelNames);
+    const std::vector<std::string> &labels() const { return labels_; }
+    void set_labels(const std::vector<std::string> &labels) { labels_ = labels; }
     void draw_result(cv::Mat& frame, Prediction result);
 
     float confThreshold;
     float nmsThreshold;
+    BoxFormat box_format;
+
+    // taken from the score tensor
+    int num_classes() const { return num_classes_; }
+
+    // stages of the last run()
+    StageTimes times;
+    int delegate() const { return npu_tpye; }
+
+    // per node timings of Invoke(), opt-in since the profiler costs a little per op
+    void set_profiling(bool enable);
+    bool profiling() const { return profiler_ != nullptr; }
+    // table of nodes, CPU ops and delegate partitions, slowest first
+    std::string profile_summary();
+    void reset_profile();
 
 private:
     // number of threads
     int nthreads;
-    int npu_tpye;    // 0:none 1:imx8mp 2:imx93 3:imx95
+    int npu_tpye;    // MLDelegate actually applied
+
+    std::string model_path_;
+    // <model dir>/cache/<model name>-<fnv1a of the model>, empty when caching is off
+    std::string cache_prefix_;
+    std::string delegate_cache_path_;
 
-    // model's
+    // time to first inference, reported once by run()
+    std::chrono::steady_clock::time_point start_time_;
+    bool first_run_ = true;
+
+    // model's, the delegate and profiler must outlive the interpreter using them
     std::unique_ptr<tflite::FlatBufferModel> model_;
+    tflite::Interpreter::TfLiteDelegatePtr delegate_;
+    std::unique_ptr<tflite::profiling::BufferedProfiler> profiler_;
     std::unique_ptr<tflite::Interpreter> interpreter_;
 
+    // profile accumulated over the invokes, keyed by event type and node index
+    struct NodeProfile
+    {
+        std::string name;
+        const char *kind;       // "cpu", "delegate" partition or "in-delegate" op
+        uint64_t calls = 0;
+        uint64_t total_us = 0;
+        uint64_t max_us = 0;
+    };
+    std::mutex profile_lock_;
+    std::map<std::pair<int, int>, NodeProfile> node_profile_;
+    uint64_t profiled_invokes_ = 0;
+    double profiled_invoke_ms_ = 0;
+    // the profiler's events and the wall time of their invoke, under profile_lock_
+    void collect_profile(double invoke_ms);
+
     // parameters of interpreter's input
     int input;
     int in_height;
@@ -67,11 +153,19 @@ private:
     TfLiteIntArray* _out_dims;
     int  _out_row;
     int  _out_colum;
+    int num_anchors_ = 0;
+    int num_classes_ = 0;
+    TensorLayout layout_ = LAYOUT_ANCHOR_FIRST;
+    std::vector<std::string> labels_;
 
     // parameters of original image
     int padded_img_height;
     int padded_img_width;
 
+    // CPU copies made for the next inference, moved to times by infer()
+    int frame_copies_ = 0;
+    int input_copies_ = 0;
+
     // Input of the interpreter
     uint8_t *_input_u8;
     float_t *_input_f32;
@@ -79,7 +173,12 @@ private:
     template <typename T>
     void seed_data(T *in, cv::Mat &src);
 
-    void apply_delegate(int npu_tpye);
+    void init_cache_prefix();
+    bool build_interpreter(int npu_tpye, int num_threads);
+    bool apply_delegate(int npu_tpye, int num_threads);
+    int select_delegate(int num_threads);
     void preprocess(cv::Mat image, cv::Mat & padded_image, cv::Mat& resized_image);
+    void infer(Prediction &result, std::chrono::steady_clock::time_point t0,
+            std::chrono::steady_clock::time_point t1);
     void draw_img(int classId, float conf, int left, int top, int right, int bottom, cv::Mat& frame);
 };
\ No newline at end of file
@@ -154,6 +154,9 @@ void YOLOV5::run(cv::Mat frame, Prediction &out_pred)
     // printf("output dims: out_batch %d,  out[1] %d out[2] %d \n", out_batch, _out_row, _out_colum);
 
     TfLiteTensor *pOutputTensor = interpreter_->tensor(interpreter_->outputs()[0]);
+    // the empty fridge is the common case, no row passes without its objectness passing
+    if (!objectnessAbove(pOutputTensor, confThreshold))
+        return;
     std::vector<std::vector<float>> predV = tensorToVector2D(pOutputTensor, _out_row, _out_colum);
 
     std::vector<int> indices;
@@ -254,6 +257,26 @@ void YOLOV5::seed_data(T *in, cv::Mat &src)
     }
 }
 
+bool YOLOV5::objectnessAbove(TfLiteTensor *pOutputTensor, float threshold)
+{
+  // objectness is column 4 of every row, strided so plain loops; int8 compares quantized
+  if (pOutputTensor->type == kTfLiteInt8) {
+    float q = threshold / pOutputTensor->params.scale + pOutputTensor->params.zero_point;
+    int8_t max_q = INT8_MIN;
+    for (int32_t i = 0; i < _out_row; i++)
+      max_q = std::max(max_q, pOutputTensor->data.int8[i * _out_colum + 4]);
+    return max_q > q;
+  } else if (pOutputTensor->type == kTfLiteFloat32) {
+    for (int32_t i = 0; i < _out_row; i++) {
+      if (pOutputTensor->data.f[i * _out_colum + 4] > threshold)
+        return true;
+    }
+    return false;
+  }
+  // tensorToVector2D reports the type
+  return true;
+}
+
 std::vector<std::vector<float>> YOLOV5::tensorToVector2D(TfLiteTensor *pOutputTensor, const int &row, const int &colum)
 {
   if (interpreter_->outputs().size() == 1) {
@@ -84,6 +84,7 @@ private:
 
     void preprocess(cv::Mat &image);
     void preprocess(cv::Mat &image, cv::Mat & padded_image);
+    bool objectnessAbove(TfLiteTensor *pOutputTensor, float threshold);
     std::vector<std::vector<float>> tensorToVector2D(TfLiteTensor *pOutputTensor, const int &row, const int &colum);
     void nonMaximumSupprition(
         std::vector<std::vector<float>> &predV,
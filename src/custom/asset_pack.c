@@ -0,0 +1,146 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "asset_pack.h"
+
+static struct {
+    const uint8_t *map;
+    size_t size;
+    const asset_pack_entry_t *entries;
+    uint32_t count;
+    lv_img_decoder_t *decoder;
+} pack;
+
+/* the entry an ASSET_PACK_IMG() descriptor names, NULL for any other image */
+static const asset_pack_entry_t *find(const void *src)
+{
+    if (!pack.map || lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+        return NULL;
+    const lv_img_dsc_t *img = src;
+    if (img->header.cf != LV_IMG_CF_USER_ENCODED_0)
+        return NULL;
+
+    for (uint32_t i = 0; i < pack.count; i++) {
+        if (!strncmp(pack.entries[i].name, (const char *)img->data, ASSET_PACK_NAME_LEN))
+            return &pack.entries[i];
+    }
+    return NULL;
+}
+
+static lv_res_t decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    const asset_pack_entry_t *e = find(src);
+    if (!e)
+        return LV_RES_INV;
+
+    header->always_zero = 0;
+    header->cf = e->cf;
+    header->w = e->w;
+    header->h = e->h;
+    return LV_RES_OK;
+}
+
+/* the whole image is in the mapping, lvgl draws from it directly */
+static lv_res_t decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    const asset_pack_entry_t *e = find(dsc->src);
+    if (!e)
+        return LV_RES_INV;
+
+    dsc->img_data = pack.map + e->offset;
+    return LV_RES_OK;
+}
+
+static int check(const char *path)
+{
+    const asset_pack_header_t *hdr = (const asset_pack_header_t *)pack.map;
+
+    if (pack.size < sizeof(*hdr) || memcmp(hdr->magic, ASSET_PACK_MAGIC, 4) || hdr->version != ASSET_PACK_VERSION) {
+        printf("%s is not an asset bundle\n", path);
+        return -1;
+    }
+    if (hdr->color_depth != LV_COLOR_DEPTH) {
+        printf("%s was packed for %u bit color, not %d\n", path, hdr->color_depth, LV_COLOR_DEPTH);
+        return -1;
+    }
+    if (hdr->count > (pack.size - sizeof(*hdr)) / sizeof(asset_pack_entry_t)) {
+        printf("%s is truncated\n", path);
+        return -1;
+    }
+
+    pack.entries = (const asset_pack_entry_t *)(pack.map + sizeof(*hdr));
+    pack.count = hdr->count;
+    for (uint32_t i = 0; i < pack.count; i++) {
+        const asset_pack_entry_t *e = &pack.entries[i];
+        if (e->offset > pack.size || e->size > pack.size - e->offset || (e->offset & 3)) {
+            printf("%s: entry %u is outside the bundle\n", path, i);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int asset_pack_open(const char *path)
+{
+    struct stat st;
+
+    if (pack.map)
+        asset_pack_close();
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        printf("Cannot open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        printf("Cannot read %s\n", path);
+        close(fd);
+        return -1;
+    }
+    /* a bundle replaced with mv later leaves this mapping alone */
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        printf("Cannot map %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    pack.map = map;
+    pack.size = st.st_size;
+    if (check(path)) {
+        asset_pack_close();
+        return -1;
+    }
+
+    if (!pack.decoder) {
+        pack.decoder = lv_img_decoder_create();
+        lv_img_decoder_set_info_cb(pack.decoder, decoder_info);
+        lv_img_decoder_set_open_cb(pack.decoder, decoder_open);
+    }
+    return 0;
+}
+
+void asset_pack_close(void)
+{
+    /* the cache would still point into the mapping */
+    lv_img_cache_invalidate_src(NULL);
+    if (pack.decoder) {
+        lv_img_decoder_delete(pack.decoder);
+        pack.decoder = NULL;
+    }
+    if (pack.map)
+        munmap((void *)pack.map, pack.size);
+    memset(&pack, 0, sizeof(pack));
+}
@@ -0,0 +1,65 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/*
+ * Images from a bundle written by tools/pack_assets.py instead of C arrays.
+ * The bundle is mapped read only, and every image is handed to lvgl as a
+ * pointer into the mapping, so its pixels are only paged in once drawn and
+ * never copied. In builds with ASSET_PACK=1 the descriptors of the screens
+ * (src/custom/asset_refs.c) only carry the name of their entry; an image
+ * decoder resolves them.
+ */
+
+#define ASSET_PACK_MAGIC "LVAP"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_NAME_LEN 40
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t color_depth;       /* LV_COLOR_DEPTH the pixels were packed for */
+    uint32_t count;             /* entries right after the header */
+} asset_pack_header_t;
+
+typedef struct {
+    char name[ASSET_PACK_NAME_LEN];     /* the lv_img_dsc_t symbol */
+    uint32_t cf, w, h;
+    uint32_t offset, size;      /* of the pixels, from the start of the bundle */
+    uint32_t reserved;
+} asset_pack_entry_t;
+
+/* a descriptor of an image of the bundle */
+#define ASSET_PACK_IMG(entry, width, height) {      \
+        .header.cf = LV_IMG_CF_USER_ENCODED_0,       \
+        .header.w = width,                           \
+        .header.h = height,                          \
+        .data_size = 0,                              \
+        .data = (const uint8_t *)entry,              \
+    }
+
+/* maps the bundle and registers its decoder, before the screens are set up; 0 on success */
+int asset_pack_open(const char *path);
+
+void asset_pack_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASSET_PACK_H */
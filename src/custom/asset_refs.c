@@ -0,0 +1,25 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+/* generated by tools/pack_assets.py from src/generated/images, do not edit */
+
+#include "asset_pack.h"
+
+#ifdef ASSET_PACK
+const lv_img_dsc_t _back_button_110x88 = ASSET_PACK_IMG("_back_button_110x88", 110, 88);
+const lv_img_dsc_t _bg_alpha_206x195 = ASSET_PACK_IMG("_bg_alpha_206x195", 206, 195);
+const lv_img_dsc_t _btn_temp_230x160 = ASSET_PACK_IMG("_btn_temp_230x160", 230, 160);
+const lv_img_dsc_t _food_camera_230x160 = ASSET_PACK_IMG("_food_camera_230x160", 230, 160);
+const lv_img_dsc_t _img_home_alpha_50x50 = ASSET_PACK_IMG("_img_home_alpha_50x50", 50, 50);
+const lv_img_dsc_t _img_light_off_alpha_230x160 = ASSET_PACK_IMG("_img_light_off_alpha_230x160", 230, 160);
+const lv_img_dsc_t _img_light_on_230x160 = ASSET_PACK_IMG("_img_light_on_230x160", 230, 160);
+const lv_img_dsc_t _nxp_alpha_100x50 = ASSET_PACK_IMG("_nxp_alpha_100x50", 100, 50);
+const lv_img_dsc_t _nxp_alpha_120x60 = ASSET_PACK_IMG("_nxp_alpha_120x60", 120, 60);
+const lv_img_dsc_t _standby_230x160 = ASSET_PACK_IMG("_standby_230x160", 230, 160);
+#endif /* ASSET_PACK */
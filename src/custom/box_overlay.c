@@ -0,0 +1,139 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#include <string.h>
+#include "box_overlay.h"
+
+#define MY_CLASS &box_overlay_class
+
+#define BOX_BORDER_WIDTH 10
+#define BOX_RADIUS 10
+
+typedef struct {
+    lv_obj_t obj;
+    box_overlay_item_t items[BOX_OVERLAY_MAX];
+    uint32_t count;
+} box_overlay_t;
+
+static void box_overlay_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void box_overlay_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t box_overlay_class = {
+    .constructor_cb = box_overlay_constructor,
+    .event_cb = box_overlay_event,
+    .instance_size = sizeof(box_overlay_t),
+    .base_class = &lv_obj_class,
+};
+
+lv_obj_t *box_overlay_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+static void box_overlay_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    box_overlay_t *overlay = (box_overlay_t *)obj;
+
+    overlay->count = 0;
+    /* only draws, touches go to the preview below */
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+}
+
+/* the box and its label, in screen coordinates */
+static void item_area(const lv_obj_t *obj, const box_overlay_item_t *item, const lv_font_t *font,
+        lv_area_t *box, lv_area_t *label)
+{
+    box->x1 = obj->coords.x1 + item->x;
+    box->y1 = obj->coords.y1 + item->y;
+    box->x2 = box->x1 + item->w - 1;
+    box->y2 = box->y1 + item->h - 1;
+
+    /* one line inside the top left corner, as wide as twice the box */
+    label->x1 = box->x1 + 2 * BOX_BORDER_WIDTH;
+    label->y1 = box->y1 + 2 * BOX_BORDER_WIDTH;
+    label->x2 = label->x1 + 2 * item->w - 1;
+    label->y2 = label->y1 + lv_font_get_line_height(font) - 1;
+}
+
+static void invalidate_items(lv_obj_t *obj, const box_overlay_item_t *items, uint32_t count)
+{
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+
+    for (uint32_t i = 0; i < count; i++) {
+        lv_area_t box, label;
+        item_area(obj, &items[i], label_dsc.font, &box, &label);
+        if (items[i].text)
+            _lv_area_join(&box, &box, &label);
+        lv_obj_invalidate_area(obj, &box);
+    }
+}
+
+void box_overlay_set_boxes(lv_obj_t *obj, const box_overlay_item_t *items, uint32_t count)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    box_overlay_t *overlay = (box_overlay_t *)obj;
+
+    if (count > BOX_OVERLAY_MAX)
+        count = BOX_OVERLAY_MAX;
+    if (count == overlay->count && memcmp(items, overlay->items, count * sizeof(*items)) == 0)
+        return;
+
+    /* where the old boxes were and where the new ones are, nothing else */
+    invalidate_items(obj, overlay->items, overlay->count);
+    memcpy(overlay->items, items, count * sizeof(*items));
+    overlay->count = count;
+    invalidate_items(obj, overlay->items, overlay->count);
+}
+
+static void draw_items(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    box_overlay_t *overlay = (box_overlay_t *)obj;
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.radius = BOX_RADIUS;
+    rect_dsc.bg_opa = LV_OPA_TRANSP;
+    rect_dsc.border_width = BOX_BORDER_WIDTH;
+    rect_dsc.border_opa = LV_OPA_100;
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+
+    for (uint32_t i = 0; i < overlay->count; i++) {
+        const box_overlay_item_t *item = &overlay->items[i];
+        lv_area_t box, label, clip;
+        item_area(obj, item, label_dsc.font, &box, &label);
+
+        if (_lv_area_intersect(&clip, &box, draw_ctx->clip_area)) {
+            rect_dsc.border_color = item->color;
+            lv_draw_rect(draw_ctx, &rect_dsc, &box);
+        }
+        if (item->text && _lv_area_intersect(&clip, &label, draw_ctx->clip_area)) {
+            label_dsc.color = item->color;
+            lv_draw_label(draw_ctx, &label_dsc, &label, item->text, NULL);
+        }
+    }
+}
+
+static void box_overlay_event(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p);
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RES_OK)
+        return;
+
+    if (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN)
+        draw_items(e);
+}
@@ -0,0 +1,44 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#ifndef BOX_OVERLAY_H
+#define BOX_OVERLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lvgl.h"
+
+#define BOX_OVERLAY_MAX 20
+
+/* one detection box, in pixels of the overlay */
+typedef struct {
+    lv_coord_t x, y, w, h;
+    lv_color_t color;
+    const char *text;           /* kept alive by the caller, NULL for no label */
+} box_overlay_item_t;
+
+/*
+ * Transparent widget drawing the detection boxes in its draw event, instead
+ * of a full size ARGB canvas. Changing the boxes invalidates the areas of the
+ * old and the new ones only, the rest of the preview is not redrawn.
+ */
+lv_obj_t *box_overlay_create(lv_obj_t *parent);
+
+/* replaces the boxes, nothing is invalidated when they did not change */
+void box_overlay_set_boxes(lv_obj_t *obj, const box_overlay_item_t *items, uint32_t count);
+
+extern const lv_obj_class_t box_overlay_class;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOX_OVERLAY_H */
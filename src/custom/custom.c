@@ -16,6 +16,7 @@
  *      INCLUDES
  *********************/
 #include <stdio.h>
+#include <time.h>
 #include "lvgl.h"
 #include "custom.h"
 
@@ -48,15 +49,16 @@ uint32_t custom_tick_get(void)
 {
     static uint64_t start_ms = 0;
     if(start_ms == 0) {
-        struct timeval tv_start;
-        gettimeofday(&tv_start, NULL);
-        start_ms = (tv_start.tv_sec * 1000000 + tv_start.tv_usec) / 1000;
+        struct timespec tv_start;
+        clock_gettime(CLOCK_MONOTONIC, &tv_start);
+        start_ms = (uint64_t)tv_start.tv_sec * 1000 + tv_start.tv_nsec / 1000000;
     }
 
-    struct timeval tv_now;
-    gettimeofday(&tv_now, NULL);
+    /* monotonic, the wall clock can jump with NTP; served by the vDSO, no syscall */
+    struct timespec tv_now;
+    clock_gettime(CLOCK_MONOTONIC, &tv_now);
     uint64_t now_ms;
-    now_ms = (tv_now.tv_sec * 1000000 + tv_now.tv_usec) / 1000;
+    now_ms = (uint64_t)tv_now.tv_sec * 1000 + tv_now.tv_nsec / 1000000;
 
     uint32_t time_ms = now_ms - start_ms;
     return time_ms;
@@ -22,6 +22,15 @@ extern "C" {
 
 #include <sys/time.h>
 #include "gui_guider.h"
+#include "box_overlay.h"
+#include "video_view.h"
+#include "drm_display.h"
+#include "ui_loop.h"
+#include "asset_pack.h"
+#include "inventory_label.h"
+
+/* the camera screen is built when the food button is pressed; 1 deletes it again when going back home */
+#define CAMERA_SCREEN_DEL_ON_EXIT 1
 
 void custom_init(lv_ui *ui);
 uint32_t custom_tick_get(void);
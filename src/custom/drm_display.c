@@ -0,0 +1,337 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include "lv_drv_conf.h"
+#include "drm_display.h"
+
+#ifndef DRM_CARD
+#define DRM_CARD "/dev/dri/card0"
+#endif
+#ifndef DRM_CONNECTOR_ID
+#define DRM_CONNECTOR_ID -1
+#endif
+
+/* flushed areas kept per refresh, beyond that the whole screen is copied */
+#define DRM_DIRTY_MAX 32
+/* waited for a flip event at a time, the flip is forced with a mode set after DRM_FLIP_RETRIES */
+#define DRM_FLIP_TIMEOUT_MS 100
+#define DRM_FLIP_RETRIES 10
+
+typedef struct {
+    uint32_t handle, fb_id, pitch;
+    uint64_t size;
+    uint8_t *map;
+} drm_buffer_t;
+
+static struct {
+    int fd;
+    uint32_t conn_id, crtc_id;
+    drmModeModeInfo mode;
+    drmModeCrtc *saved_crtc;
+    drm_buffer_t bufs[2];
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_drv_t *drv;
+    /* areas lvgl drew into the back buffer during the current refresh */
+    lv_area_t dirty[DRM_DIRTY_MAX];
+    int dirty_count;
+    bool dirty_all;
+    int front;                  /* buffer being scanned out */
+    bool flip_pending;
+    uintptr_t flip_seq;         /* of the last flip queued, its event carries it back */
+} drm = {.fd = -1};
+
+static uint32_t find_crtc(drmModeRes *res, drmModeConnector *conn)
+{
+    drmModeEncoder *enc = conn->encoder_id ? drmModeGetEncoder(drm.fd, conn->encoder_id) : NULL;
+    if (enc) {
+        uint32_t crtc_id = enc->crtc_id;
+        drmModeFreeEncoder(enc);
+        if (crtc_id)
+            return crtc_id;
+    }
+
+    /* not driven yet, the first crtc any of its encoders can use */
+    for (int i = 0; i < conn->count_encoders; i++) {
+        enc = drmModeGetEncoder(drm.fd, conn->encoders[i]);
+        if (!enc)
+            continue;
+        for (int j = 0; j < res->count_crtcs; j++) {
+            if (enc->possible_crtcs & (1 << j)) {
+                drmModeFreeEncoder(enc);
+                return res->crtcs[j];
+            }
+        }
+        drmModeFreeEncoder(enc);
+    }
+    return 0;
+}
+
+static int find_output(void)
+{
+    drmModeRes *res = drmModeGetResources(drm.fd);
+    if (!res) {
+        printf("drmModeGetResources failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    int ret = -1;
+    for (int i = 0; i < res->count_connectors && ret; i++) {
+        drmModeConnector *conn = drmModeGetConnector(drm.fd, res->connectors[i]);
+        if (!conn)
+            continue;
+        bool wanted = DRM_CONNECTOR_ID < 0 ? conn->connection == DRM_MODE_CONNECTED
+                                            : conn->connector_id == (uint32_t)DRM_CONNECTOR_ID;
+        if (wanted && conn->count_modes > 0) {
+            /* the preferred mode, else the first one */
+            drm.mode = conn->modes[0];
+            for (int m = 0; m < conn->count_modes; m++) {
+                if (conn->modes[m].type & DRM_MODE_TYPE_PREFERRED) {
+                    drm.mode = conn->modes[m];
+                    break;
+                }
+            }
+            drm.conn_id = conn->connector_id;
+            drm.crtc_id = find_crtc(res, conn);
+            if (drm.crtc_id)
+                ret = 0;
+        }
+        drmModeFreeConnector(conn);
+    }
+    drmModeFreeResources(res);
+
+    if (ret)
+        printf("No connected DRM output on %s\n", DRM_CARD);
+    return ret;
+}
+
+static int create_buffer(drm_buffer_t *buf, uint32_t w, uint32_t h)
+{
+    struct drm_mode_create_dumb create = {.height = h, .width = w, .bpp = 32};
+    if (drmIoctl(drm.fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) < 0) {
+        printf("Cannot create dumb buffer: %s\n", strerror(errno));
+        return -1;
+    }
+    buf->handle = create.handle;
+    buf->pitch = create.pitch;
+    buf->size = create.size;
+
+    /* lvgl draws with a stride of the horizontal resolution */
+    if (buf->pitch != w * sizeof(lv_color_t)) {
+        printf("Dumb buffer pitch %u does not match %u pixels\n", buf->pitch, w);
+        return -1;
+    }
+    if (drmModeAddFB(drm.fd, w, h, 24, 32, buf->pitch, buf->handle, &buf->fb_id)) {
+        printf("drmModeAddFB failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    struct drm_mode_map_dumb map = {.handle = buf->handle};
+    if (drmIoctl(drm.fd, DRM_IOCTL_MODE_MAP_DUMB, &map) < 0)
+        return -1;
+    buf->map = mmap(NULL, buf->size, PROT_READ | PROT_WRITE, MAP_SHARED, drm.fd, map.offset);
+    if (buf->map == MAP_FAILED) {
+        buf->map = NULL;
+        printf("Cannot map dumb buffer: %s\n", strerror(errno));
+        return -1;
+    }
+    memset(buf->map, 0, buf->size);
+    return 0;
+}
+
+static void destroy_buffer(drm_buffer_t *buf)
+{
+    if (buf->map)
+        munmap(buf->map, buf->size);
+    if (buf->fb_id)
+        drmModeRmFB(drm.fd, buf->fb_id);
+    if (buf->handle) {
+        struct drm_mode_destroy_dumb destroy = {.handle = buf->handle};
+        drmIoctl(drm.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+    }
+    memset(buf, 0, sizeof(*buf));
+}
+
+/* brings the new back buffer up to date with the areas the front one got */
+static void sync_back_buffer(void)
+{
+    const drm_buffer_t *src = &drm.bufs[drm.front];
+    drm_buffer_t *dst = &drm.bufs[!drm.front];
+
+    if (drm.dirty_all) {
+        memcpy(dst->map, src->map, src->size);
+        return;
+    }
+    for (int i = 0; i < drm.dirty_count; i++) {
+        const lv_area_t *a = &drm.dirty[i];
+        uint32_t offset = a->y1 * src->pitch + a->x1 * sizeof(lv_color_t);
+        uint32_t len = lv_area_get_width(a) * sizeof(lv_color_t);
+        for (lv_coord_t y = a->y1; y <= a->y2; y++, offset += src->pitch)
+            memcpy(dst->map + offset, src->map + offset, len);
+    }
+}
+
+static void flip_done(void)
+{
+    drm.front = !drm.front;
+    drm.flip_pending = false;
+    sync_back_buffer();
+    drm.dirty_count = 0;
+    drm.dirty_all = false;
+    /* the old front buffer is free, lvgl can draw into it */
+    lv_disp_flush_ready(drm.drv);
+}
+
+static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec,
+        void *user_data)
+{
+    /* not the late event of a flip already forced, which would complete the next one early */
+    if (drm.flip_pending && (uintptr_t)user_data == drm.flip_seq)
+        flip_done();
+}
+
+static void handle_events(int timeout_ms)
+{
+    struct pollfd pfd = {.fd = drm.fd, .events = POLLIN};
+    if (poll(&pfd, 1, timeout_ms) <= 0)
+        return;
+
+    drmEventContext ctx = {
+        .version = 2,
+        .page_flip_handler = page_flip_handler,
+    };
+    drmHandleEvent(drm.fd, &ctx);
+}
+
+static void drm_display_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    if (drm.dirty_count < DRM_DIRTY_MAX)
+        drm.dirty[drm.dirty_count++] = *area;
+    else
+        drm.dirty_all = true;
+
+    if (!lv_disp_flush_is_last(drv)) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+
+    /* in direct mode color_p is the start of the buffer drawn into */
+    int back = (uint8_t *)color_p == drm.bufs[0].map ? 0 : 1;
+    drm.flip_seq++;
+    if (drmModePageFlip(drm.fd, drm.crtc_id, drm.bufs[back].fb_id, DRM_MODE_PAGE_FLIP_EVENT,
+            (void *)drm.flip_seq)) {
+        printf("drmModePageFlip failed: %s\n", strerror(errno));
+        drmModeSetCrtc(drm.fd, drm.crtc_id, drm.bufs[back].fb_id, 0, 0, &drm.conn_id, 1, &drm.mode);
+        flip_done();
+        return;
+    }
+    drm.flip_pending = true;
+}
+
+/* lvgl waits here before drawing into a buffer still queued for scan out */
+static void drm_display_wait_cb(lv_disp_drv_t *drv)
+{
+    LV_UNUSED(drv);
+    drm_display_wait(0);
+}
+
+int drm_display_init(lv_disp_drv_t *drv)
+{
+    drm.fd = open(DRM_CARD, O_RDWR | O_CLOEXEC);
+    if (drm.fd < 0) {
+        printf("Cannot open %s: %s\n", DRM_CARD, strerror(errno));
+        return -1;
+    }
+    if (find_output())
+        goto fail;
+
+    uint32_t w = drm.mode.hdisplay, h = drm.mode.vdisplay;
+    if (create_buffer(&drm.bufs[0], w, h) || create_buffer(&drm.bufs[1], w, h))
+        goto fail;
+
+    /* scan out the second buffer, lvgl starts drawing into the first */
+    drm.saved_crtc = drmModeGetCrtc(drm.fd, drm.crtc_id);
+    drm.front = 1;
+    if (drmModeSetCrtc(drm.fd, drm.crtc_id, drm.bufs[1].fb_id, 0, 0, &drm.conn_id, 1, &drm.mode)) {
+        printf("drmModeSetCrtc failed: %s\n", strerror(errno));
+        goto fail;
+    }
+    printf("DRM %s: %ux%u@%u, double buffered\n", DRM_CARD, w, h, drm.mode.vrefresh);
+
+    lv_disp_draw_buf_init(&drm.draw_buf, drm.bufs[0].map, drm.bufs[1].map, w * h);
+    drv->draw_buf = &drm.draw_buf;
+    drv->hor_res = w;
+    drv->ver_res = h;
+    drv->direct_mode = 1;
+    drv->flush_cb = drm_display_flush;
+    drv->wait_cb = drm_display_wait_cb;
+    drm.drv = drv;
+    return 0;
+
+fail:
+    drm_display_exit();
+    return -1;
+}
+
+void drm_display_wait(uint32_t timeout_ms)
+{
+    if (drm.flip_pending) {
+        /* the buffers only swap once the back one is really scanned out, lvgl draws into the other next */
+        for (int i = 0; i < DRM_FLIP_RETRIES && drm.flip_pending; i++)
+            handle_events(DRM_FLIP_TIMEOUT_MS);
+        if (drm.flip_pending) {
+            printf("Page flip timed out, setting the mode instead\n");
+            drmModeSetCrtc(drm.fd, drm.crtc_id, drm.bufs[!drm.front].fb_id, 0, 0, &drm.conn_id, 1, &drm.mode);
+            flip_done();
+        }
+        return;
+    }
+    handle_events(timeout_ms);
+}
+
+int drm_display_fd(void)
+{
+    return drm.fd;
+}
+
+bool drm_display_flip_pending(void)
+{
+    return drm.flip_pending;
+}
+
+void drm_display_handle_events(void)
+{
+    handle_events(0);
+}
+
+void drm_display_exit(void)
+{
+    if (drm.fd < 0)
+        return;
+    if (drm.saved_crtc) {
+        drmModeCrtc *c = drm.saved_crtc;
+        drmModeSetCrtc(drm.fd, c->crtc_id, c->buffer_id, c->x, c->y, &drm.conn_id, 1, &c->mode);
+        drmModeFreeCrtc(c);
+        drm.saved_crtc = NULL;
+    }
+    destroy_buffer(&drm.bufs[0]);
+    destroy_buffer(&drm.bufs[1]);
+    close(drm.fd);
+    drm.fd = -1;
+}
@@ -0,0 +1,53 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#ifndef DRM_DISPLAY_H
+#define DRM_DISPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+/*
+ * DRM/KMS display with two full screen dumb buffers. lvgl draws the dirty
+ * areas straight into the back buffer (direct mode), the last area of a
+ * refresh queues a page flip to it, and the buffer is handed back to lvgl
+ * once the flip completed at vblank, after the areas it got were copied
+ * into the other one. Nothing is ever drawn into the scanned out buffer.
+ */
+
+/* opens DRM_CARD, sets the mode and fills drv (after lv_disp_drv_init), 0 on success */
+int drm_display_init(lv_disp_drv_t *drv);
+
+/*
+ * Paces the UI loop: waits for the queued page flip when there is one,
+ * otherwise for timeout_ms, handling the flip events of the DRM fd.
+ */
+void drm_display_wait(uint32_t timeout_ms);
+
+/* the DRM fd, readable when a page flip completed */
+int drm_display_fd(void);
+
+/* true while the last frame waits for vblank, lvgl cannot draw the next one yet */
+bool drm_display_flip_pending(void);
+
+/* handles the completed flips without waiting, when the fd is readable */
+void drm_display_handle_events(void);
+
+void drm_display_exit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRM_DISPLAY_H */
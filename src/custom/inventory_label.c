@@ -0,0 +1,23 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#include "inventory_label.h"
+
+lv_obj_t *inventory_label_create(lv_ui *ui)
+{
+    lv_obj_t *label = lv_label_create(ui->screen);
+    lv_label_set_text(label, "");
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    lv_obj_set_pos(label, 128, 80);
+    lv_obj_set_size(label, 387, 22);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xbbbbbb), LV_PART_MAIN|LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(label, &lv_font_montserratMedium_16, LV_PART_MAIN|LV_STATE_DEFAULT);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN|LV_STATE_DEFAULT);
+    return label;
+}
@@ -0,0 +1,26 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#ifndef INVENTORY_LABEL_H
+#define INVENTORY_LABEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_guider.h"
+
+/* the inventory summary under the welcome line of the home screen, empty until the first result */
+lv_obj_t *inventory_label_create(lv_ui *ui);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INVENTORY_LABEL_H */
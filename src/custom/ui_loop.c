@@ -0,0 +1,177 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "drm_display.h"
+#include "ui_loop.h"
+
+/* input read timer kept running that long after the last touch event */
+#define UI_INPUT_IDLE_MS 1000
+
+enum {
+    UI_FD_TIMER,
+    UI_FD_EVENT,
+    UI_FD_INPUT,
+    UI_FD_DISPLAY,
+};
+
+static struct {
+    int epoll_fd, timer_fd, event_fd;
+    lv_indev_t *indev;
+    uint32_t last_input;        /* tick of the last touch event */
+    ui_loop_wakeups_t wakeups;
+} loop = {.epoll_fd = -1, .timer_fd = -1, .event_fd = -1};
+
+static int watch(int fd, uint32_t tag)
+{
+    struct epoll_event ev = {.events = EPOLLIN, .data.u32 = tag};
+    if (epoll_ctl(loop.epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        printf("epoll_ctl failed: %s\n", strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+int ui_loop_init(lv_indev_t *indev)
+{
+    loop.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    loop.timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    loop.event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (loop.epoll_fd < 0 || loop.timer_fd < 0 || loop.event_fd < 0) {
+        printf("Cannot create the UI loop fds: %s\n", strerror(errno));
+        return -1;
+    }
+    if (watch(loop.timer_fd, UI_FD_TIMER) || watch(loop.event_fd, UI_FD_EVENT))
+        return -1;
+    if (drm_display_fd() >= 0 && watch(drm_display_fd(), UI_FD_DISPLAY))
+        return -1;
+
+    loop.indev = indev;
+    loop.last_input = lv_tick_get();
+    return 0;
+}
+
+void ui_loop_watch_input(int fd)
+{
+    if (fd >= 0)
+        watch(fd, UI_FD_INPUT);
+}
+
+void ui_loop_wake(void)
+{
+    uint64_t one = 1;
+
+    /* several posts before the loop reads it make a single wake up */
+    if (loop.event_fd >= 0)
+        write(loop.event_fd, &one, sizeof(one));
+}
+
+/* the refresh timer runs while there is something to draw, the ms until it is due */
+static uint32_t sync_refr_timer(uint32_t next_ms)
+{
+    lv_disp_t *disp = lv_disp_get_default();
+    lv_timer_t *refr = disp ? disp->refr_timer : NULL;
+    if (!refr)
+        return next_ms;
+
+    if (!disp->inv_p) {
+        lv_timer_pause(refr);
+        return next_ms;
+    }
+    lv_timer_resume(refr);
+    uint32_t elapsed = lv_tick_elaps(refr->last_run);
+    uint32_t due = elapsed >= refr->period ? 0 : refr->period - elapsed;
+    return due < next_ms ? due : next_ms;
+}
+
+/* the input is read while touched and for a while after, then only on touch events */
+static void sync_read_timer(void)
+{
+    lv_timer_t *read = loop.indev ? loop.indev->driver->read_timer : NULL;
+    if (!read || read->paused)
+        return;
+    if (loop.indev->proc.state == LV_INDEV_STATE_RELEASED && lv_tick_elaps(loop.last_input) > UI_INPUT_IDLE_MS)
+        lv_timer_pause(read);
+}
+
+uint32_t ui_loop_run_timers(void)
+{
+    /* the commands run before may have invalidated areas */
+    sync_refr_timer(LV_NO_TIMER_READY);
+    uint32_t next_ms = lv_timer_handler();
+    sync_read_timer();
+    return sync_refr_timer(next_ms);
+}
+
+static void drain(int fd)
+{
+    uint64_t count;
+    read(fd, &count, sizeof(count));
+}
+
+void ui_loop_wait(uint32_t timeout_ms)
+{
+    /* nothing can be drawn before the last frame is on screen */
+    if (drm_display_flip_pending()) {
+        drm_display_wait(0);
+        loop.wakeups.display++;
+        return;
+    }
+
+    /* a zero timer disarms it, a due timer is only a poll */
+    struct itimerspec its = {0};
+    if (timeout_ms != LV_NO_TIMER_READY && timeout_ms > 0) {
+        its.it_value.tv_sec = timeout_ms / 1000;
+        its.it_value.tv_nsec = (timeout_ms % 1000) * 1000000L;
+    }
+    timerfd_settime(loop.timer_fd, 0, &its, NULL);
+
+    struct epoll_event events[4];
+    int n = epoll_wait(loop.epoll_fd, events, 4, timeout_ms == 0 ? 0 : -1);
+    if (n == 0)
+        loop.wakeups.timer++;
+    for (int i = 0; i < n; i++) {
+        switch (events[i].data.u32) {
+        case UI_FD_TIMER:
+            drain(loop.timer_fd);
+            loop.wakeups.timer++;
+            break;
+        case UI_FD_EVENT:
+            drain(loop.event_fd);
+            loop.wakeups.post++;
+            break;
+        case UI_FD_INPUT:
+            /* lvgl reads the events itself, right away */
+            if (loop.indev) {
+                lv_timer_t *read = loop.indev->driver->read_timer;
+                lv_timer_resume(read);
+                lv_timer_ready(read);
+            }
+            loop.last_input = lv_tick_get();
+            loop.wakeups.input++;
+            break;
+        case UI_FD_DISPLAY:
+            drm_display_handle_events();
+            loop.wakeups.display++;
+            break;
+        }
+    }
+}
+
+void ui_loop_take_wakeups(ui_loop_wakeups_t *wakeups)
+{
+    *wakeups = loop.wakeups;
+    memset(&loop.wakeups, 0, sizeof(loop.wakeups));
+}
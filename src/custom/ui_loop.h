@@ -0,0 +1,55 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#ifndef UI_LOOP_H
+#define UI_LOOP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+
+/* why the UI loop woke up, counted since the last ui_loop_take_wakeups() */
+typedef struct {
+    uint64_t timer;             /* an lvgl timer was due */
+    uint64_t post;              /* ui_loop_wake() from another thread */
+    uint64_t input;             /* touch events */
+    uint64_t display;           /* page flip completed */
+} ui_loop_wakeups_t;
+
+/*
+ * Tickless UI loop: sleeps in epoll_wait on a timerfd armed with the next
+ * lvgl timer deadline, an eventfd the other threads write to, the input
+ * device and the DRM fd. The display refresh timer only runs while
+ * something is invalidated and the input read timer only while the touch
+ * screen is in use, so an idle screen does not wake up at all.
+ */
+int ui_loop_init(lv_indev_t *indev);
+
+/* the fd of the input device, once it is open */
+void ui_loop_watch_input(int fd);
+
+/* any thread: makes the UI loop run, after posting it something */
+void ui_loop_wake(void);
+
+/* lv_timer_handler() with the refresh timer following the invalidated areas, the ms to the next timer */
+uint32_t ui_loop_run_timers(void);
+
+/* until the next timer, a wake up, input or a page flip */
+void ui_loop_wait(uint32_t timeout_ms);
+
+void ui_loop_take_wakeups(ui_loop_wakeups_t *wakeups);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_LOOP_H */
@@ -0,0 +1,193 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#include <pthread.h>
+#include <string.h>
+#include "video_view.h"
+
+#define MY_CLASS &video_view_class
+
+typedef struct {
+    const void *data;
+    lv_coord_t w, h;
+} video_frame_t;
+
+typedef struct {
+    lv_obj_t obj;
+    /* written by the submitting thread */
+    pthread_mutex_t lock;
+    video_frame_t pending;
+    uint32_t submitted;
+    /* lvgl thread only */
+    video_frame_t shown;
+    uint32_t refreshed;
+    lv_img_dsc_t img;           /* for the blended path */
+} video_view_t;
+
+static void video_view_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void video_view_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void video_view_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t video_view_class = {
+    .constructor_cb = video_view_constructor,
+    .destructor_cb = video_view_destructor,
+    .event_cb = video_view_event,
+    .instance_size = sizeof(video_view_t),
+    .base_class = &lv_obj_class,
+};
+
+lv_obj_t *video_view_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+static void video_view_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    video_view_t *view = (video_view_t *)obj;
+
+    pthread_mutex_init(&view->lock, NULL);
+    memset(&view->pending, 0, sizeof(view->pending));
+    memset(&view->shown, 0, sizeof(view->shown));
+    memset(&view->img, 0, sizeof(view->img));
+    view->submitted = 0;
+    view->refreshed = 0;
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+}
+
+static void video_view_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    video_view_t *view = (video_view_t *)obj;
+
+    pthread_mutex_destroy(&view->lock);
+}
+
+void video_view_submit_frame(lv_obj_t *obj, const void *frame, lv_coord_t w, lv_coord_t h)
+{
+    video_view_t *view = (video_view_t *)obj;
+
+    pthread_mutex_lock(&view->lock);
+    view->pending.data = frame;
+    view->pending.w = w;
+    view->pending.h = h;
+    view->submitted++;
+    pthread_mutex_unlock(&view->lock);
+}
+
+bool video_view_refresh(lv_obj_t *obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    video_view_t *view = (video_view_t *)obj;
+
+    pthread_mutex_lock(&view->lock);
+    bool fresh = view->submitted != view->refreshed;
+    view->refreshed = view->submitted;
+    video_frame_t frame = view->pending;
+    pthread_mutex_unlock(&view->lock);
+
+    if (!fresh)
+        return false;
+    if (frame.data != view->shown.data)
+        lv_img_cache_invalidate_src(&view->img);
+    view->shown = frame;
+    /* the preview only, the widgets around it keep their pixels */
+    lv_obj_invalidate(obj);
+    return true;
+}
+
+/* the part of the widget the frame covers, in screen coordinates */
+static bool frame_area(const lv_obj_t *obj, const video_frame_t *frame, lv_area_t *area)
+{
+    if (!frame->data)
+        return false;
+    area->x1 = obj->coords.x1;
+    area->y1 = obj->coords.y1;
+    area->x2 = area->x1 + frame->w - 1;
+    area->y2 = area->y1 + frame->h - 1;
+    return _lv_area_intersect(area, area, &obj->coords);
+}
+
+static void cover_check(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    video_view_t *view = (video_view_t *)obj;
+    lv_cover_check_info_t *info = lv_event_get_param(e);
+    lv_area_t area;
+
+    if (info->res == LV_COVER_RES_MASKED)
+        return;
+    /* the base class said no for the transparent background, the frame decides */
+    if (frame_area(obj, &view->shown, &area) && _lv_area_is_in(info->area, &area, 0) &&
+        lv_obj_get_style_opa(obj, LV_PART_MAIN) >= LV_OPA_MAX)
+        info->res = LV_COVER_RES_COVER;
+    else
+        info->res = LV_COVER_RES_NOT_COVER;
+}
+
+static void draw_frame(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_target(e);
+    video_view_t *view = (video_view_t *)obj;
+    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    const video_frame_t *frame = &view->shown;
+    lv_area_t area, clip;
+
+    if (!frame_area(obj, frame, &area) || !_lv_area_intersect(&clip, &area, draw_ctx->clip_area))
+        return;
+
+#if LV_COLOR_DEPTH == 32
+    /* rows of the frame are already in the buffer format, unless a mask clips them */
+    if (!lv_draw_mask_is_any(&clip)) {
+        if (draw_ctx->wait_for_finish)
+            draw_ctx->wait_for_finish(draw_ctx);
+
+        lv_coord_t buf_w = lv_area_get_width(draw_ctx->buf_area);
+        lv_coord_t copy_w = lv_area_get_width(&clip);
+        lv_color_t *dst = (lv_color_t *)draw_ctx->buf + (clip.y1 - draw_ctx->buf_area->y1) * buf_w +
+                          (clip.x1 - draw_ctx->buf_area->x1);
+        const lv_color_t *src = (const lv_color_t *)frame->data + (clip.y1 - obj->coords.y1) * frame->w +
+                                (clip.x1 - obj->coords.x1);
+        for (lv_coord_t y = clip.y1; y <= clip.y2; y++) {
+            memcpy(dst, src, copy_w * sizeof(lv_color_t));
+            dst += buf_w;
+            src += frame->w;
+        }
+        return;
+    }
+#endif
+
+    view->img.header.cf = LV_IMG_CF_TRUE_COLOR;
+    view->img.header.w = frame->w;
+    view->img.header.h = frame->h;
+    view->img.data_size = frame->w * frame->h * sizeof(lv_color_t);
+    view->img.data = frame->data;
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    area.x2 = area.x1 + frame->w - 1;
+    area.y2 = area.y1 + frame->h - 1;
+    lv_draw_img(draw_ctx, &img_dsc, &area, &view->img);
+}
+
+static void video_view_event(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p);
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RES_OK)
+        return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_COVER_CHECK)
+        cover_check(e);
+    else if (code == LV_EVENT_DRAW_MAIN)
+        draw_frame(e);
+}
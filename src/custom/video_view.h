@@ -0,0 +1,47 @@
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+
+#ifndef VIDEO_VIEW_H
+#define VIDEO_VIEW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+/*
+ * Opaque camera preview. The frames are never scaled nor blended, so the
+ * draw event copies their rows straight into the draw buffer instead of
+ * going through the image decoder and the blender, and the widget covers
+ * its area so nothing below it is drawn.
+ */
+lv_obj_t *video_view_create(lv_obj_t *parent);
+
+/*
+ * Shows a w x h frame in the native color format (BGRA with 32 bit color)
+ * at the top left of the widget. Can be called from any thread; the frame
+ * must stay valid and unchanged while lvgl draws, until the next one.
+ */
+void video_view_submit_frame(lv_obj_t *obj, const void *frame, lv_coord_t w, lv_coord_t h);
+
+/*
+ * On the lvgl thread, before lv_task_handler(): invalidates the widget area
+ * when a frame was submitted since the last call, true then.
+ */
+bool video_view_refresh(lv_obj_t *obj);
+
+extern const lv_obj_class_t video_view_class;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIDEO_VIEW_H */
@@ -14,6 +14,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include "lvgl.h"
+#include "custom.h"
 #include "matter/log_parse.h"
 
 extern bool g_ui_camera;
@@ -50,6 +51,13 @@ static void screen_btn_food_event_handler (lv_event_t *e)
 	lv_event_code_t code = lv_event_get_code(e);
 
 	switch (code) {
+	case LV_EVENT_PRESSED:
+	{
+		//Build the camera screen while the button is held down, the click only loads it.
+		if (guider_ui.camera_del == true)
+			setup_scr_camera(&guider_ui);
+		break;
+	}
 	case LV_EVENT_CLICKED:
 	{
 		//Write the load screen code.
@@ -57,6 +65,8 @@ static void screen_btn_food_event_handler (lv_event_t *e)
 		lv_disp_t * d = lv_obj_get_disp(act_scr);
 		if (d->prev_scr == NULL &&
 				(d->scr_to_load == NULL || d->scr_to_load == act_scr)) {
+			if (guider_ui.camera_del == true)
+				setup_scr_camera(&guider_ui);
 			lv_scr_load_anim(guider_ui.camera,
 				LV_SCR_LOAD_ANIM_NONE, 200, 200, false);
 			g_ui_camera = true;
@@ -109,7 +119,7 @@ static void camera_btn_back_event_handler (lv_event_t *e)
 				(d->scr_to_load == NULL || d->scr_to_load == act_scr)) {
 			g_ui_camera = false;
 			lv_scr_load_anim(guider_ui.screen,
-				LV_SCR_LOAD_ANIM_NONE, 200, 200, false);
+				LV_SCR_LOAD_ANIM_NONE, 200, 200, CAMERA_SCREEN_DEL_ON_EXIT);
 		}
 		break;
 	}
@@ -117,8 +127,31 @@ static void camera_btn_back_event_handler (lv_event_t *e)
 		break;
 	}
 }
+static void camera_event_handler (lv_event_t *e)
+{
+	lv_event_code_t code = lv_event_get_code(e);
+
+	switch (code) {
+	case LV_EVENT_DELETE:
+	{
+		//Built again on the next visit, nothing may use the deleted objects.
+		guider_ui.camera = NULL;
+		guider_ui.camera_btn_back = NULL;
+		guider_ui.camera_btn_back_label = NULL;
+		guider_ui.camera_video = NULL;
+		guider_ui.camera_box_overlay = NULL;
+		guider_ui.camera_img_logo = NULL;
+		guider_ui.camera_del = true;
+		break;
+	}
+	default:
+		break;
+	}
+}
+
 void events_init_camera(lv_ui *ui)
 {
+	lv_obj_add_event_cb(ui->camera, camera_event_handler, LV_EVENT_ALL, NULL);
 	lv_obj_add_event_cb(ui->camera_btn_back, camera_btn_back_event_handler, LV_EVENT_ALL, NULL);
 }
 
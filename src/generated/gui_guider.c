@@ -20,9 +20,15 @@ void ui_init_style(lv_style_t * style)
     lv_style_init(style);
 }
 
+void init_scr_del_flag(lv_ui *ui)
+{
+  ui->screen_del = true;
+  ui->camera_del = true;
+}
+
 void setup_ui(lv_ui *ui)
 {
+  init_scr_del_flag(ui);
   setup_scr_screen(ui);
-  setup_scr_camera(ui);
   lv_scr_load(ui->screen);
 }
@@ -19,6 +19,7 @@ typedef struct
 {
   
 	lv_obj_t *screen;
+	bool screen_del;
 	lv_obj_t *screen_img_fridge;
 	lv_obj_t *screen_label_Date;
 	lv_obj_t *screen_label_Time;
@@ -36,10 +37,11 @@ typedef struct
 	lv_obj_t *screen_label_weather;
 	lv_obj_t *screen_img_light_off;
 	lv_obj_t *camera;
+	bool camera_del;
 	lv_obj_t *camera_btn_back;
 	lv_obj_t *camera_btn_back_label;
-	lv_obj_t *camera_img_display;
-	lv_obj_t *camera_canvas_boxes;
+	lv_obj_t *camera_video;
+	lv_obj_t *camera_box_overlay;
 	lv_obj_t *camera_img_logo;
 }lv_ui;
 
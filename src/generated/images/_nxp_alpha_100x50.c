@@ -24,7 +24,60 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG__NXP_ALPHA_100X50 uint8_t _nxp_alpha_100x50_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
+  /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x24, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x04, 0x00, 0x49, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x4c, 0x4d, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x24, 0x00, 0x7b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x00, 0x49, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x98, 0x75, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xda, 0x00, 0x29, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x72, 0x00, 0x75, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0x49, 0x00, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x7b, 0x00, 0x24, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xb1, 0x00, 0x6d, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x25, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x49, 0x00, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0x92, 0x00, 0x32, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x7b, 0x00, 0x24, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xd5, 0x00, 0x49, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x4d, 0x00, 0x00, 0x49, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x29, 0x00, 0xb9, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0x24, 0x00, 0xbb, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x7b, 0x00, 0x00, 0x36, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x9b, 0x00, 0x4d, 0x78, 0x78, 0x78, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf9, 0x25, 0x25, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x29, 0x92, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x00, 0x00, 0x9d, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0x68, 0x00, 0xbb, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5b, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x32, 0x00, 0x92, 0x78, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x44, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x00, 0x00, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x49, 0x00, 0x94, 0x78, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd5, 0x24, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb1, 0x00, 0x72, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x29, 0x00, 0xdb, 0x78, 0x78, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xda, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd6, 0x00, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x7b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x24, 0x25, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x91, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x44, 0x00, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xda, 0x00, 0x2d, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0xb6, 0x00, 0x4c, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0xb1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x24, 0x00, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x24, 0x24, 0x5b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x00, 0x00, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x24, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x24, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x49, 0x00, 0x75, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x95, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x49, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd6, 0xfe, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x25, 0x00, 0x97, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5b, 0x00, 0x49, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x91, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd5, 0x00, 0x49, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x29, 0x00, 0xbd, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x24, 0x00, 0x36, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x7b, 0x00, 0x24, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf9, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb1, 0x00, 0x6d, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x72, 0x00, 0x95, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x49, 0x00, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x32, 0xdf, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5b, 0x00, 0x00, 0x98, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x8d, 0x00, 0x29, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x5b, 0x00, 0x00, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x52, 0x00, 0x71, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x75, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0x00, 0x24, 0x5b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x2d, 0x00, 0x00, 0x72, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x00, 0x00, 0x98, 0x78, 0x78, 0x78, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x95, 0xba, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb5, 0x00, 0x52, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x24, 0x00, 0x00, 0x00, 0x5b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x72, 0x00, 0x4d, 0x78, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xd9, 0x00, 0x00, 0x5b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x29, 0x00, 0x00, 0x00, 0x00, 0x29, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x24, 0x24, 0x99, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xf8, 0xf8, 0xf8, 0xf8, 0x6d, 0x00, 0x52, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x32, 0x00, 0x49, 0x78, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xf8, 0xf8, 0xf9, 0x00, 0x29, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x37, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3b, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x3b, 0x29, 0x00, 0x79, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xf8, 0x49, 0x00, 0x77, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x56, 0x00, 0x6d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xd5, 0x00, 0x29, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x25, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+#endif
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -36,36 +89,36 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG__NXP_ALPH
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x2e, 0xf8, 0x67, 0xf8, 0x67, 0xf8, 0x67, 0xf8, 0x67, 0xf8, 0x67, 0xf8, 0x67, 0xf8, 0x67, 0xf9, 0x64, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x59, 0xff, 0x01, 0xbf, 0x1e, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0xbf, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x3b, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x17, 0x67, 0x3b, 0x67, 0x9b, 0x16, 0x00, 0x00, 0xbe, 0x5a, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x78, 0x67, 0x9d, 0x67, 0xbe, 0x65, 0xbe, 0x3a, 0xbe, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfe, 0xfa, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf4, 0xf9, 0x1b, 0x5b, 0x04, 0x7b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xa7, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xe7, 0xbb, 0x0e, 0xff, 0x55, 0x98, 0xf8, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xff, 0x99, 0xca, 0xdf, 0x51, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xeb, 0x00, 0x00, 0x7b, 0x49, 0x3b, 0xfe, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x3b, 0xfd, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0xbf, 0x8b, 0x00, 0x00, 0x9d, 0xa8, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbd, 0x6e, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0x55, 0xff, 0x0b, 0x3b, 0xf4, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xd0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x7b, 0xf0, 0xdf, 0x05, 0xff, 0x1a, 0x98, 0xfb, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xde, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xc7, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf9, 0xaf, 0x00, 0x00, 0xff, 0x7d, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xbf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x34, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9b, 0x61, 0xff, 0x0b, 0x9d, 0xcf, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x9d, 0xd1, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfe, 0xf9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xfd, 0xff, 0x98, 0x00, 0x00, 0x3b, 0xb2, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe9, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x7b, 0xed, 0x93, 0x02, 0x99, 0x25, 0x78, 0xfe, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xdf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xda, 0xfa, 0x05, 0xdf, 0x53, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9f, 0x62, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x51, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xfe, 0x9f, 0x4d, 0xff, 0x04, 0xbd, 0xeb, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbe, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfe, 0xfe, 0x27, 0x00, 0x00, 0xbf, 0xeb, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x7b, 0xfd, 0x00, 0x00, 0x1f, 0x01, 0x3b, 0xc6, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9b, 0xf2, 0x00, 0x00, 0xbe, 0x5e, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xf8, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0xbe, 0xdf, 0x98, 0xf3, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xcb, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xf8, 0xff, 0x2c, 0x9b, 0x2c, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0x63, 0xff, 0x85, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xfc, 0xbf, 0x0d, 0x00, 0x00, 0x9d, 0xf2, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x4b, 0x98, 0xfd, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xdf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0x64, 0x00, 0x00, 0xdf, 0xe1, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xae, 0x00, 0x00, 0xdf, 0xa0, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xcb, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xde, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xfb, 0xff, 0x05, 0xbf, 0x11, 0x3b, 0xfc, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xff, 0x3d, 0xba, 0x07, 0x98, 0xe2, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x85, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xde, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xe4, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xa8, 0x00, 0x00, 0x9b, 0xa4, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0x6a, 0x00, 0x00, 0xff, 0xe5, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x6a, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xde, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xd4, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfd, 0x00, 0x00, 0xbf, 0x03, 0x7b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0xbf, 0x23, 0xff, 0x36, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xcb, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xde, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0xfa, 0x9e, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0x37, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xe6, 0x00, 0x00, 0x5b, 0x78, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x9d, 0x7a, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xd6, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xde, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0xff, 0x0a, 0xf9, 0xb2, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfb, 0xf9, 0x30, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfb, 0xfe, 0x2d, 0xff, 0x1a, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xd6, 0x9b, 0x04, 0x00, 0x00, 0x98, 0xfa, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x57, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x98, 0xdb, 0xdf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0xfe, 0x17, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xee, 0xff, 0x23, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xee, 0xff, 0x02, 0x5b, 0x25, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xdf, 0x53, 0x00, 0x00, 0x99, 0xc1, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xdb, 0x78, 0x50, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0x78, 0x4e, 0xde, 0xba, 0x98, 0xfd, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x99, 0xd2, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x48, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0xd8, 0xfe, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x9b, 0xe4, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xfc, 0xff, 0x08, 0xde, 0x51, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbe, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x94, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xd8, 0x00, 0x00, 0xbf, 0x50, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9b, 0x5b, 0x00, 0x00, 0xbd, 0xf3, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbe, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xf9, 0xb2, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0x1d, 0x00, 0x00, 0x3b, 0xc2, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x7b, 0xf4, 0x00, 0x00, 0xdf, 0x1a, 0x98, 0xf8, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x9d, 0xff, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x15, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xb5, 0x00, 0x00, 0xdf, 0x77, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0x37, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9f, 0xa0, 0x00, 0x00, 0xbd, 0xb4, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbe, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0xf8, 0xfe, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0x53, 0xbb, 0x05, 0x3b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xa8, 0xdf, 0xed, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x98, 0xfe, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbd, 0xfc, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x70, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0x90, 0x00, 0x00, 0x5b, 0x5e, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xff, 0x9b, 0x12, 0x7f, 0x06, 0x3b, 0xe1, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9f, 0x92, 0x00, 0x00, 0xbe, 0x9c, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0x78, 0xff, 0xbd, 0xae, 0xde, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xb6, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xf7, 0xfe, 0x0b, 0xff, 0x13, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0x75, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xa8, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xf4, 0x7b, 0x0f, 0xff, 0x0f, 0x98, 0xfc, 0x78, 0xff, 0x78, 0xff, 0x78, 0xfa, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x78, 0xe8, 0x99, 0xe8, 0xde, 0xe8, 0xde, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0xf8, 0xbf, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xb4, 0x00, 0x00, 0x7b, 0x9c, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xdf, 0x21, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x5b, 0xf9, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x9b, 0xaa, 0x00, 0x00, 0xbe, 0x6a, 0x78, 0xff, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x50, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xec, 0x00, 0x00, 0x93, 0x02, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xbf, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x63, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xbf, 0x28, 0xff, 0x19, 0x99, 0xed, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xfe, 0x57, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfa, 0x73, 0xff, 0x01, 0x7b, 0xb0, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xdc, 0xbf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x7b, 0xf7, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0x9b, 0x00, 0x00, 0xbe, 0x54, 0x78, 0xff, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xf9, 0xb2, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xf8, 0xff, 0x12, 0xbf, 0x38, 0x3b, 0xfc, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xff, 0xdf, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x25, 0x3b, 0xfe, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x3b, 0xff, 0xdf, 0x3e, 0x00, 0x00, 0x9d, 0xd6, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x72, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xf9, 0xbb, 0xf8, 0xff, 0xfe, 0x4d, 0x00, 0x00, 0x9b, 0xd9, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x5b, 0xd9, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x5b, 0xd1, 0xbf, 0x03, 0xdf, 0x77, 0x78, 0xcb, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x72, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x51, 0xf9, 0xd9, 0xff, 0x06, 0xdf, 0x39, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x9f, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x5b, 0xfd, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0xbf, 0x32, 0x00, 0x00, 0x9d, 0x8b, 0x9e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0e, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x19, 0x00, 0x00, 0xdf, 0x12, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xbf, 0x20, 0xdf, 0x0a, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x31, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x63, 0x62, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x5a, 0x00, 0x00, 0xc4, 0x10, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0xa3, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x4b, 0x12, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x4b, 0x0a, 0x83, 0x08, 0x00, 0x00, 0x65, 0x3a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa3, 0x32, 0xc5, 0x42, 0xa4, 0x29, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc1, 0xfd, 0x04, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xf6, 0xa1, 0x18, 0x20, 0x00, 0x1d, 0x56, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x2f, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x4c, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x39, 0x1d, 0x62, 0x08, 0xaa, 0x52, 0x43, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x84, 0x7e, 0x23, 0x65, 0x47, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe3, 0xfd, 0x64, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0x4f, 0xee, 0x00, 0x00, 0xc8, 0x19, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xbc, 0x2d, 0xa7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0xbc, 0x2d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xd0, 0x5b, 0x00, 0x00, 0x64, 0x5c, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x62, 0x76, 0xe5, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x06, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0x46, 0x52, 0x61, 0x08, 0x7b, 0x2d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x75, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x75, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xdb, 0x4d, 0x21, 0x08, 0xc3, 0x18, 0x43, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x61, 0x76, 0xe6, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x2c, 0xc5, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0x04, 0xac, 0x00, 0x00, 0xcf, 0x73, 0xbc, 0x25, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xbc, 0x25, 0xa3, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x19, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x6b, 0x32, 0x61, 0x08, 0x67, 0x75, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x65, 0x6d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc1, 0xfd, 0x62, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa1, 0xfd, 0x91, 0x94, 0x00, 0x00, 0xf4, 0x1b, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x5a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x7e, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xfb, 0x6d, 0x00, 0x00, 0x01, 0x11, 0x61, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xe6, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0xfd, 0x83, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0x03, 0xdd, 0x20, 0x08, 0x6a, 0x42, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x8c, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x32, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x09, 0x2a, 0x20, 0x00, 0x4a, 0x96, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x4c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x87, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xc0, 0xfd, 0x23, 0x29, 0x00, 0x00, 0x7c, 0x96, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x3d, 0x66, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xfc, 0x6d, 0x00, 0x00, 0x85, 0x3a, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x43, 0x76, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0x43, 0x76, 0x61, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xc3, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x2a, 0xcd, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc5, 0xf5, 0x65, 0x29, 0x05, 0x19, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x4b, 0x1a, 0xf0, 0x73, 0x9c, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xbc, 0x2d, 0x61, 0x08, 0x00, 0x00, 0x68, 0x8e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x62, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xa3, 0x6d, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc1, 0xfd, 0x01, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x42, 0x62, 0x00, 0x00, 0x3b, 0xa6, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x1d, 0x4e, 0x9c, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xf3, 0x23, 0x00, 0x00, 0x8e, 0x84, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x7d, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x83, 0x65, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0xfd, 0x83, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe6, 0xfd, 0x21, 0x08, 0x82, 0x08, 0xbd, 0x35, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xbc, 0x35, 0xc7, 0x31, 0x20, 0x00, 0xa3, 0x6d, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x4b, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x83, 0x65, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x67, 0xe5, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x08, 0xa4, 0x00, 0x00, 0x13, 0x4c, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x6c, 0x1a, 0x00, 0x00, 0xf6, 0xc6, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x3a, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x83, 0x65, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xb1, 0xd5, 0xe3, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x2a, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe4, 0xfd, 0x00, 0x00, 0x20, 0x00, 0x3d, 0x56, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x04, 0x19, 0x85, 0x31, 0x61, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x95, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x83, 0x65, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x09, 0x9c, 0xc1, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0xfd, 0x41, 0x39, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x30, 0xe6, 0x00, 0x00, 0xee, 0x22, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xd8, 0xa5, 0x00, 0x00, 0x23, 0x43, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x75, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x83, 0x65, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x41, 0x08, 0x44, 0xb4, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0xfd, 0x22, 0x31, 0x00, 0x00, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0xfd, 0x23, 0x29, 0xc3, 0x18, 0xdc, 0x45, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xd7, 0x1c, 0x20, 0x00, 0x00, 0x00, 0x43, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x3a, 0x61, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xa3, 0x6d, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0xa2, 0x18, 0x27, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa7, 0xed, 0x03, 0x21, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa6, 0xed, 0x00, 0x00, 0xe4, 0x08, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xbc, 0x25, 0x6a, 0x42, 0x00, 0x00, 0xe5, 0x64, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x81, 0x65, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x4c, 0x8d, 0x83, 0x7e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x63, 0x65, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4a, 0xe3, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x8b, 0xd5, 0x90, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x44, 0x29, 0x00, 0x00, 0xda, 0x6d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xdd, 0x35, 0x41, 0x08, 0x46, 0x3a, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x2a, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x93, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0xfd, 0x29, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x48, 0xd5, 0x00, 0x00, 0x29, 0x32, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x4a, 0x2a, 0x00, 0x00, 0x8b, 0x9e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x45, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xb4, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0x20, 0x00, 0x00, 0x35, 0x14, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xdc, 0x55, 0x00, 0x00, 0xc2, 0x10, 0x42, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xa7, 0x8e, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x10, 0x49, 0xfe, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x67, 0xb4, 0x00, 0x00, 0x6e, 0x5b, 0x9c, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xdc, 0x2d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x33, 0x54, 0x00, 0x00, 0xc8, 0x6c, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xe7, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x41, 0xc1, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x69, 0x52, 0x21, 0x00, 0x9c, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xd2, 0x13, 0x9c, 0xae, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9b, 0x45, 0x00, 0x00, 0x00, 0x00, 0x83, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0xab, 0x9e, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x72, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x86, 0x93, 0x00, 0x00, 0x4b, 0x22, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xdc, 0x35, 0x82, 0x08, 0x21, 0x00, 0x19, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xd1, 0x53, 0x00, 0x00, 0x27, 0x64, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x62, 0x76, 0xa6, 0x64, 0xc2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xb4, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc4, 0xf5, 0x41, 0x08, 0xa2, 0x10, 0xdc, 0x35, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xcd, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x53, 0x5c, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x5b, 0x15, 0x62, 0x08, 0x82, 0x10, 0x43, 0x76, 0x60, 0x6e, 0x60, 0x6e, 0x40, 0x6e, 0xc0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xe6, 0x7d, 0xb2, 0xb6, 0xe2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x10, 0x62, 0xbc, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xcc, 0xb4, 0x00, 0x00, 0xd2, 0x3b, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x25, 0xe4, 0x18, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x1c, 0x56, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x74, 0x5c, 0x00, 0x00, 0xc5, 0x42, 0x60, 0x6e, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x52, 0xe3, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0x66, 0xed, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x3d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xa7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x22, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1d, 0x05, 0x19, 0xc3, 0x18, 0x05, 0x76, 0x60, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x5a, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe6, 0x72, 0x00, 0x00, 0x34, 0x3c, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xf8, 0x1c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xfc, 0x5d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xb1, 0x23, 0x00, 0x00, 0x45, 0x3a, 0x61, 0x6e, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x46, 0xb4, 0xa0, 0xfd, 0xa0, 0xfd, 0xe6, 0xf5, 0x82, 0x10, 0x87, 0x21, 0x7c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1d, 0x31, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x08, 0x9c, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xbc, 0x25, 0xc8, 0x31, 0x00, 0x00, 0x86, 0x75, 0x21, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x72, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xf0, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x63, 0xbc, 0xa1, 0xfd, 0x05, 0x4a, 0x00, 0x00, 0x79, 0x6d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x34, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x18, 0x3d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0xd8, 0x34, 0x20, 0x00, 0x69, 0x5b, 0x22, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x72, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x10, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x52, 0x68, 0xd5, 0x21, 0x08, 0xa7, 0x31, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0x4a, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x21, 0xfd, 0x45, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0x1d, 0x4e, 0x66, 0x21, 0x00, 0x00, 0xa6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xa2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x18, 0x00, 0x00, 0x82, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0x41, 0x08, 0x00, 0x00, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -76,173 +129,120 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG__NXP_ALPH
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 #endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x2e, 0xa0, 0xfd, 0x67, 0xa0, 0xfd, 0x67, 0xa0, 0xfd, 0x67, 0xa0, 0xfd, 0x67, 0xa0, 0xfd, 0x67, 0xa0, 0xfd, 0x67, 0xa0, 0xfd, 0x67, 0x07, 0xfe, 0x64, 0x5a, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0x59, 0xff, 0xff, 0x01, 0xbe, 0x96, 0x1e, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0xbd, 0x9e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x0a, 0xbc, 0x25, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x7c, 0x15, 0x67, 0x9c, 0x1d, 0x67, 0x3e, 0x7e, 0x16, 0x00, 0x00, 0x00, 0xee, 0xae, 0x5a, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0x60, 0x6e, 0x67, 0xa7, 0x86, 0x67, 0xec, 0xa6, 0x65, 0x10, 0xaf, 0x3a, 0x32, 0xaf, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc1, 0xfd, 0xfe, 0x8d, 0xfe, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xfe, 0xf4, 0xea, 0xfd, 0x1b, 0x18, 0x46, 0x04, 0x1d, 0x56, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x1d, 0x4e, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x76, 0xa7, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x1d, 0xe7, 0x5e, 0x96, 0x0e, 0xdd, 0xef, 0x55, 0x63, 0x76, 0xf8, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x84, 0x7e, 0xff, 0x84, 0x7e, 0xca, 0x55, 0xc7, 0x51, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe3, 0xfd, 0xff, 0xb2, 0xfe, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xd0, 0xfe, 0xeb, 0x00, 0x00, 0x00, 0x3d, 0x5e, 0x49, 0x9c, 0x15, 0xfe, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x2d, 0xff, 0x7f, 0xdf, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xaf, 0x23, 0xbc, 0x2d, 0xfd, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfe, 0xa6, 0x8b, 0x00, 0x00, 0x00, 0xa6, 0x8e, 0xa8, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x62, 0x76, 0xff, 0xcb, 0x9e, 0x6e, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x07, 0xfe, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xb3, 0xfe, 0x55, 0x5f, 0xd7, 0x0b, 0xbc, 0x2d, 0xf4, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfc, 0x35, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x8e, 0xd0, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x3d, 0x56, 0xf0, 0xff, 0xd7, 0x05, 0xfc, 0xef, 0x1a, 0x63, 0x76, 0xfb, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xff, 0x10, 0xb7, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xaf, 0xfe, 0xc7, 0xfd, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xe6, 0xfd, 0xaf, 0x00, 0x00, 0x00, 0xdf, 0xef, 0x7d, 0xbc, 0x25, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x25, 0xff, 0x1f, 0x97, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x7e, 0x34, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x7d, 0x7e, 0x61, 0xfd, 0xef, 0x0b, 0xa9, 0x8e, 0xcf, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0xa6, 0x86, 0xd1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc1, 0xfd, 0xfe, 0x4b, 0xfe, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa1, 0xfd, 0xfd, 0xbd, 0xff, 0x98, 0x00, 0x00, 0x00, 0xbc, 0x25, 0xb2, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdc, 0x4d, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x86, 0xe9, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x7d, 0x76, 0xed, 0x1f, 0x84, 0x02, 0x86, 0x86, 0x25, 0x61, 0x76, 0xfe, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x56, 0xc7, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc2, 0xfd, 0xff, 0x8e, 0xfe, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe4, 0xfd, 0xda, 0x73, 0xfe, 0x05, 0x5f, 0xcf, 0x53, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbe, 0x8e, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xa6, 0x51, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xfe, 0xbe, 0x8e, 0x4d, 0xff, 0xff, 0x04, 0xcb, 0x9e, 0xeb, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x10, 0xb7, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x28, 0xfe, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc0, 0xfd, 0xfe, 0x13, 0xff, 0x27, 0x00, 0x00, 0x00, 0xfe, 0x9e, 0xeb, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x3d, 0x66, 0xfd, 0x00, 0x00, 0x00, 0xff, 0x07, 0x01, 0xbc, 0x1d, 0xc6, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x5d, 0x76, 0xf2, 0x00, 0x00, 0x00, 0xcd, 0x96, 0x5e, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x63, 0x76, 0xf8, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0xce, 0x9e, 0xdf, 0x83, 0x7e, 0xf3, 0x61, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x64, 0x76, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x8d, 0xfe, 0xcb, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe5, 0xfd, 0xf8, 0xde, 0xff, 0x2c, 0x3d, 0x7e, 0x2c, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdc, 0x45, 0x63, 0x7f, 0xd7, 0x85, 0x9c, 0x1d, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdc, 0x2d, 0xfc, 0xdd, 0xa6, 0x0d, 0x00, 0x00, 0x00, 0xc8, 0x96, 0xf2, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x96, 0x4b, 0x62, 0x76, 0xfd, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x83, 0x7e, 0xdb, 0xfa, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc1, 0xfd, 0xff, 0x08, 0xfe, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe4, 0xfd, 0x64, 0x00, 0x00, 0x00, 0x1f, 0xbf, 0xe1, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x1d, 0x4e, 0xff, 0x9c, 0x1d, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdc, 0x35, 0xae, 0x00, 0x00, 0x00, 0x56, 0xcf, 0xa0, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x9e, 0xcb, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x63, 0x76, 0xdb, 0xf3, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc2, 0xfd, 0xff, 0x6c, 0xfe, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x06, 0xfe, 0xfb, 0xfa, 0xff, 0x05, 0x1e, 0xaf, 0x11, 0xdd, 0x35, 0xfc, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x35, 0xff, 0x9f, 0xdf, 0x3d, 0xce, 0x95, 0x07, 0x63, 0x7e, 0xe2, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x96, 0x85, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x63, 0x76, 0xdb, 0xf3, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc2, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x08, 0xfe, 0xe4, 0x39, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x2c, 0xfe, 0xa8, 0x00, 0x00, 0x00, 0x3d, 0x76, 0xa4, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdd, 0x3d, 0x6a, 0x00, 0x00, 0x00, 0xb9, 0xdf, 0xe5, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x86, 0x6a, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x63, 0x76, 0xdb, 0xf3, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xd4, 0xfe, 0xd4, 0xe3, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x6d, 0xfe, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe4, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xaf, 0x03, 0x3d, 0x56, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfe, 0xb6, 0x23, 0x79, 0xdf, 0x36, 0x61, 0x76, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xb7, 0xcb, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x63, 0x76, 0xdb, 0xf3, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x6f, 0xfe, 0x9e, 0xc1, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa1, 0xfd, 0xff, 0xc4, 0xfd, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xd2, 0xfe, 0xe6, 0x00, 0x00, 0x00, 0x3d, 0x4e, 0x78, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x7f, 0xd7, 0xc7, 0x00, 0x00, 0x00, 0x86, 0x86, 0x7a, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x8e, 0xd6, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x63, 0x76, 0xdb, 0xf3, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0xff, 0xff, 0x0a, 0x06, 0xfe, 0xb2, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc1, 0xfd, 0xfb, 0x2a, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xc1, 0xfd, 0xfb, 0xb1, 0xfe, 0x2d, 0xbf, 0xef, 0x1a, 0xdc, 0x45, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x1d, 0xd6, 0x1f, 0x86, 0x04, 0x00, 0x00, 0x00, 0x63, 0x76, 0xfa, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa6, 0x57, 0x61, 0x76, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x83, 0x7e, 0xdb, 0xfa, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0xb2, 0xfe, 0x17, 0x27, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x07, 0xfe, 0xee, 0xf5, 0xfe, 0x23, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x06, 0xfe, 0xee, 0xff, 0xff, 0x02, 0xfc, 0x55, 0x25, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x25, 0xff, 0x5f, 0xcf, 0x53, 0x00, 0x00, 0x00, 0x87, 0x86, 0xc1, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xdb, 0x41, 0x76, 0x50, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x61, 0x76, 0x4e, 0x31, 0xbf, 0xba, 0x83, 0x7e, 0xfd, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x84, 0x7e, 0xd2, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0x48, 0xe3, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x8d, 0xfe, 0xd8, 0x90, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x37, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x7d, 0x76, 0xe4, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfd, 0x35, 0xfc, 0xff, 0xe7, 0x08, 0x33, 0xbf, 0x51, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0xed, 0xa6, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xfe, 0x94, 0xc2, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa1, 0xfd, 0xff, 0x29, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x4a, 0xfe, 0xd8, 0x00, 0x00, 0x00, 0xde, 0x9e, 0x50, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x7d, 0x7e, 0x5b, 0x00, 0x00, 0x00, 0xec, 0xa6, 0xf3, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x10, 0xaf, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x08, 0xfe, 0xb2, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf3, 0xfe, 0x1d, 0x00, 0x00, 0x00, 0x9c, 0x1d, 0xc2, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x1d, 0x56, 0xf4, 0x00, 0x00, 0x00, 0x75, 0xbf, 0x1a, 0x62, 0x76, 0xf8, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0xa7, 0x8e, 0xff, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xf6, 0x15, 0x49, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x4a, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x3f, 0xc7, 0x77, 0x9c, 0x1d, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdc, 0x2d, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbe, 0x86, 0xa0, 0x00, 0x00, 0x00, 0xcb, 0x9e, 0xb4, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0xec, 0xa6, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0x44, 0xc1, 0xfd, 0xfe, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x7b, 0xff, 0x53, 0x7a, 0x9e, 0x05, 0x9c, 0x1d, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x1d, 0xa8, 0x1e, 0xbf, 0xed, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfd, 0x45, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x76, 0xfe, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0xcb, 0x9e, 0xfc, 0xfb, 0xdf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xfe, 0x70, 0xc2, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x4b, 0xfe, 0x90, 0x00, 0x00, 0x00, 0x1d, 0x56, 0x5e, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdc, 0x35, 0xff, 0x5c, 0x96, 0x12, 0xbf, 0x5e, 0x06, 0xbc, 0x1d, 0xe1, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9e, 0x96, 0x92, 0x00, 0x00, 0x00, 0xcc, 0x9e, 0x9c, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x62, 0x76, 0xff, 0xc9, 0x96, 0xae, 0x74, 0xc7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xb6, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe4, 0xfd, 0xf7, 0x91, 0xfe, 0x0b, 0xbe, 0xdf, 0x13, 0xdc, 0x35, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x3d, 0x56, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x8e, 0xa8, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xf4, 0x7e, 0x6e, 0x0f, 0xfc, 0xe7, 0x0f, 0x63, 0x76, 0xfc, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xfa, 0x60, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x40, 0x6e, 0xe8, 0x87, 0x86, 0xe8, 0x54, 0xc7, 0xe8, 0x53, 0xb7, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0x14, 0xe3, 0xfd, 0xbf, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xd1, 0xfe, 0xb4, 0x00, 0x00, 0x00, 0x3d, 0x5e, 0x9c, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x25, 0xff, 0x1e, 0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x0c, 0x3d, 0x56, 0xf9, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9e, 0x86, 0xaa, 0x00, 0x00, 0x00, 0xcd, 0xa6, 0x6a, 0x60, 0x6e, 0xff, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0x50, 0xe3, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xe6, 0xfd, 0xec, 0x00, 0x00, 0x00, 0x1f, 0x84, 0x02, 0xfd, 0x3d, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xde, 0x9e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x55, 0x63, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x1d, 0xff, 0xbe, 0x96, 0x28, 0xba, 0xdf, 0x19, 0x85, 0x7e, 0xed, 0x60, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8f, 0xfe, 0x57, 0xc2, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x6d, 0xfe, 0x73, 0xff, 0xff, 0x01, 0x1d, 0x56, 0xb0, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x25, 0xdc, 0xff, 0x9f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x07, 0x3d, 0x5e, 0xf7, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfc, 0x3d, 0x9b, 0x00, 0x00, 0x00, 0x0f, 0xaf, 0x54, 0x61, 0x6e, 0xff, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x29, 0xfe, 0xb2, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0x06, 0xfe, 0xf8, 0xfe, 0xff, 0x12, 0xfe, 0x9e, 0x38, 0x9c, 0x15, 0xfc, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x1d, 0xff, 0x5f, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x45, 0x25, 0x9c, 0x1d, 0xfe, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xbc, 0x25, 0xff, 0x5f, 0xcf, 0x3e, 0x00, 0x00, 0x00, 0xa7, 0x8e, 0xd6, 0x61, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0x72, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xa0, 0xfd, 0xff, 0xf6, 0xfe, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0x0f, 0x04, 0xfe, 0xbb, 0xa1, 0xfd, 0xff, 0x8f, 0xfe, 0x4d, 0x00, 0x00, 0x00, 0x7d, 0x7e, 0xd9, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xfd, 0x3d, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x07, 0xfc, 0x45, 0xd9, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0x9c, 0x15, 0xff, 0xdd, 0x3d, 0xd1, 0xff, 0xaf, 0x03, 0x54, 0xc7, 0x77, 0x62, 0x76, 0xcb, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xfe, 0x72, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0x17, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xff, 0x51, 0x49, 0xfe, 0xd9, 0xfb, 0xff, 0x06, 0x3e, 0xcf, 0x39, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0x9e, 0x8e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x2a, 0xfd, 0x45, 0xfd, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0x1d, 0x4e, 0xff, 0xff, 0xae, 0x32, 0x00, 0x00, 0x00, 0xcb, 0x96, 0x8b, 0xf0, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0x0e, 0x13, 0xff, 0x20, 0x13, 0xff, 0x20, 0x13, 0xff, 0x20, 0x13, 0xff, 0x20, 0x13, 0xff, 0x20, 0x13, 0xff, 0x20, 0x13, 0xff, 0x20, 0x5a, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0x19, 0x00, 0x00, 0x00, 0x3e, 0xcf, 0x12, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xa6, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0xde, 0x9e, 0x20, 0x5d, 0xb7, 0x0a, 0x00, 0x00, 0x00, 0xfb, 0xdf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x2e, 0xfd, 0xa0, 0x67, 0xfd, 0xa0, 0x67, 0xfd, 0xa0, 0x67, 0xfd, 0xa0, 0x67, 0xfd, 0xa0, 0x67, 0xfd, 0xa0, 0x67, 0xfd, 0xa0, 0x67, 0xfe, 0x07, 0x64, 0xff, 0x5a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0x59, 0xff, 0xff, 0x01, 0x96, 0xbe, 0x1e, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x9e, 0xbd, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x0a, 0x25, 0xbc, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x15, 0x7c, 0x67, 0x1d, 0x9c, 0x67, 0x7e, 0x3e, 0x16, 0x00, 0x00, 0x00, 0xae, 0xee, 0x5a, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x6e, 0x60, 0x67, 0x86, 0xa7, 0x67, 0xa6, 0xec, 0x65, 0xaf, 0x10, 0x3a, 0xaf, 0x32, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc1, 0xfe, 0xfe, 0x8d, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xb2, 0xf4, 0xfd, 0xea, 0x1b, 0x46, 0x18, 0x04, 0x56, 0x1d, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x4e, 0x1d, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x3d, 0xa7, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x1d, 0xbc, 0xe7, 0x96, 0x5e, 0x0e, 0xef, 0xdd, 0x55, 0x76, 0x63, 0xf8, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x7e, 0x84, 0xff, 0x7e, 0x84, 0xca, 0xc7, 0x55, 0x51, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe3, 0xff, 0xfe, 0xb2, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfe, 0xd0, 0xeb, 0x00, 0x00, 0x00, 0x5e, 0x3d, 0x49, 0x15, 0x9c, 0xfe, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x2d, 0xbc, 0xff, 0xdf, 0x7f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x3f, 0x23, 0x2d, 0xbc, 0xfd, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0xa6, 0xfe, 0x8b, 0x00, 0x00, 0x00, 0x8e, 0xa6, 0xa8, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x62, 0xff, 0x9e, 0xcb, 0x6e, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x07, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xb3, 0x55, 0xd7, 0x5f, 0x0b, 0x2d, 0xbc, 0xf4, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x35, 0xfc, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x9e, 0xd0, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x56, 0x3d, 0xf0, 0xd7, 0xff, 0x05, 0xef, 0xfc, 0x1a, 0x76, 0x63, 0xfb, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xff, 0xb7, 0x10, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xaf, 0xc7, 0xff, 0xfd, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe6, 0xaf, 0x00, 0x00, 0x00, 0xef, 0xdf, 0x7d, 0x25, 0xbc, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x25, 0xbc, 0xff, 0x97, 0x1f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x5d, 0x34, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x7e, 0x7d, 0x61, 0xef, 0xfd, 0x0b, 0x8e, 0xa9, 0xcf, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x86, 0xa6, 0xd1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc1, 0xfe, 0xfe, 0x4b, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa1, 0xfd, 0xff, 0xbd, 0x98, 0x00, 0x00, 0x00, 0x25, 0xbc, 0xb2, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x4d, 0xdc, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x9e, 0xe9, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x76, 0x7d, 0xed, 0x84, 0x1f, 0x02, 0x86, 0x86, 0x25, 0x76, 0x61, 0xfe, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0xc7, 0x56, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc2, 0xff, 0xfe, 0x8e, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe4, 0xda, 0xfe, 0x73, 0x05, 0xcf, 0x5f, 0x53, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x8e, 0xbe, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xbe, 0x51, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xfe, 0x8e, 0xbe, 0x4d, 0xff, 0xff, 0x04, 0x9e, 0xcb, 0xeb, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0xb7, 0x10, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x28, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc0, 0xfe, 0xff, 0x13, 0x27, 0x00, 0x00, 0x00, 0x9e, 0xfe, 0xeb, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x66, 0x3d, 0xfd, 0x00, 0x00, 0x00, 0x07, 0xff, 0x01, 0x1d, 0xbc, 0xc6, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x76, 0x5d, 0xf2, 0x00, 0x00, 0x00, 0x96, 0xcd, 0x5e, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x63, 0xf8, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x9e, 0xce, 0xdf, 0x7e, 0x83, 0xf3, 0x6e, 0x61, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x64, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x8d, 0xcb, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe5, 0xf8, 0xff, 0xde, 0x2c, 0x7e, 0x3d, 0x2c, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x45, 0xdc, 0x63, 0xd7, 0x7f, 0x85, 0x1d, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x2d, 0xdc, 0xfc, 0xa6, 0xdd, 0x0d, 0x00, 0x00, 0x00, 0x96, 0xc8, 0xf2, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xcc, 0x4b, 0x76, 0x62, 0xfd, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x7e, 0x83, 0xdb, 0xd7, 0xfa, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc1, 0xff, 0xfe, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe4, 0x64, 0x00, 0x00, 0x00, 0xbf, 0x1f, 0xe1, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x4e, 0x1d, 0xff, 0x1d, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x35, 0xdc, 0xae, 0x00, 0x00, 0x00, 0xcf, 0x56, 0xa0, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xcc, 0xcb, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x63, 0xdb, 0xd7, 0xf3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc2, 0xff, 0xfe, 0x6c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x06, 0xfb, 0xff, 0xfa, 0x05, 0xaf, 0x1e, 0x11, 0x35, 0xdd, 0xfc, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x35, 0xbc, 0xff, 0xdf, 0x9f, 0x3d, 0x95, 0xce, 0x07, 0x7e, 0x63, 0xe2, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xc9, 0x85, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x63, 0xdb, 0xd7, 0xf3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc2, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x08, 0xe4, 0xff, 0x39, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x2c, 0xa8, 0x00, 0x00, 0x00, 0x76, 0x3d, 0xa4, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x3d, 0xdd, 0x6a, 0x00, 0x00, 0x00, 0xdf, 0xb9, 0xe5, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x85, 0x6a, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x63, 0xdb, 0xd7, 0xf3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xd4, 0xd4, 0xfd, 0xe3, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x6d, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe4, 0xfd, 0x00, 0x00, 0x00, 0xaf, 0xff, 0x03, 0x56, 0x3d, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0xb6, 0xfe, 0x23, 0xdf, 0x79, 0x36, 0x76, 0x61, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x30, 0xcb, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x63, 0xdb, 0xd7, 0xf3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0xfe, 0x6f, 0x9e, 0xfd, 0xc1, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa1, 0xff, 0xfd, 0xc4, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xd2, 0xe6, 0x00, 0x00, 0x00, 0x4e, 0x3d, 0x78, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0xd7, 0x7f, 0xc7, 0x00, 0x00, 0x00, 0x86, 0x86, 0x7a, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xa8, 0xd6, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x63, 0xdb, 0xd7, 0xf3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0xff, 0xff, 0x0a, 0xfe, 0x06, 0xb2, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc1, 0xfb, 0xfe, 0x2a, 0x30, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xc1, 0xfb, 0xfe, 0xb1, 0x2d, 0xef, 0xbf, 0x1a, 0x45, 0xdc, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x1d, 0xbc, 0xd6, 0x86, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x76, 0x63, 0xfa, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xcf, 0x57, 0x76, 0x61, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x7e, 0x83, 0xdb, 0xd7, 0xfa, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0xfe, 0xb2, 0x17, 0xfe, 0x27, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x07, 0xee, 0xfe, 0xf5, 0x23, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x06, 0xee, 0xff, 0xff, 0x02, 0x55, 0xfc, 0x25, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x25, 0xbc, 0xff, 0xcf, 0x5f, 0x53, 0x00, 0x00, 0x00, 0x86, 0x87, 0xc1, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xdb, 0x76, 0x41, 0x50, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0x76, 0x61, 0x4e, 0xbf, 0x31, 0xba, 0x7e, 0x83, 0xfd, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x7e, 0x84, 0xd2, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x15, 0x48, 0xfd, 0xe3, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x8d, 0xd8, 0xfe, 0x90, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xff, 0x37, 0x2d, 0x00, 0x00, 0x00, 0x76, 0x7d, 0xe4, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x35, 0xfd, 0xfc, 0xe7, 0xff, 0x08, 0xbf, 0x33, 0x51, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0xa6, 0xed, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xb0, 0x94, 0xfd, 0xc2, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa1, 0xff, 0xfe, 0x29, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x4a, 0xd8, 0x00, 0x00, 0x00, 0x9e, 0xde, 0x50, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x7e, 0x7d, 0x5b, 0x00, 0x00, 0x00, 0xa6, 0xec, 0xf3, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0xaf, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xfe, 0x08, 0xb2, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf3, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x9c, 0xc2, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x56, 0x1d, 0xf4, 0x00, 0x00, 0x00, 0xbf, 0x75, 0x1a, 0x76, 0x62, 0xf8, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x8e, 0xa7, 0xff, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xf4, 0x15, 0xfe, 0x49, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x4a, 0xb5, 0x00, 0x00, 0x00, 0xc7, 0x3f, 0x77, 0x1d, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x2d, 0xdc, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x86, 0xbe, 0xa0, 0x00, 0x00, 0x00, 0x9e, 0xcb, 0xb4, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0xa6, 0xec, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x44, 0xfd, 0xc1, 0xfe, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xff, 0x7b, 0x53, 0x9e, 0x7a, 0x05, 0x1d, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x1d, 0xbc, 0xa8, 0xbf, 0x1e, 0xed, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x45, 0xfd, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x83, 0xfe, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x9e, 0xcb, 0xfc, 0xdf, 0xfb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xaf, 0x70, 0xfd, 0xc2, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x56, 0x1d, 0x5e, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x35, 0xdc, 0xff, 0x96, 0x5c, 0x12, 0x5e, 0xbf, 0x06, 0x1d, 0xbc, 0xe1, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x96, 0x9e, 0x92, 0x00, 0x00, 0x00, 0x9e, 0xcc, 0x9c, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x62, 0xff, 0x96, 0xc9, 0xae, 0xc7, 0x74, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x08, 0xb6, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe4, 0xf7, 0xfe, 0x91, 0x0b, 0xdf, 0xbe, 0x13, 0x35, 0xdc, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x56, 0x3d, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x9d, 0xa8, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xf4, 0x6e, 0x7e, 0x0f, 0xe7, 0xfc, 0x0f, 0x76, 0x63, 0xfc, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xfa, 0x6e, 0x60, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x6e, 0x40, 0xe8, 0x86, 0x87, 0xe8, 0xc7, 0x54, 0xe8, 0xb7, 0x53, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x56, 0x14, 0xfd, 0xe3, 0xbf, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xd1, 0xb4, 0x00, 0x00, 0x00, 0x5e, 0x3d, 0x9c, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x25, 0x9c, 0xff, 0xbf, 0x1e, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x0c, 0x56, 0x3d, 0xf9, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x86, 0x9e, 0xaa, 0x00, 0x00, 0x00, 0xa6, 0xcd, 0x6a, 0x6e, 0x60, 0xff, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x36, 0x50, 0xfd, 0xe3, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xe6, 0xec, 0x00, 0x00, 0x00, 0x84, 0x1f, 0x02, 0x3d, 0xfd, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x9e, 0xde, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xfd, 0x63, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x1d, 0x9c, 0xff, 0x96, 0xbe, 0x28, 0xdf, 0xba, 0x19, 0x7e, 0x85, 0xed, 0x6e, 0x60, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xfe, 0x8f, 0x57, 0xfd, 0xc2, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x6d, 0x73, 0xff, 0xff, 0x01, 0x56, 0x1d, 0xb0, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x25, 0xbc, 0xdc, 0x9f, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x07, 0x5e, 0x3d, 0xf7, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x3d, 0xfc, 0x9b, 0x00, 0x00, 0x00, 0xaf, 0x0f, 0x54, 0x6e, 0x61, 0xff, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xfe, 0x29, 0xb2, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0x06, 0xf8, 0xff, 0xfe, 0x12, 0x9e, 0xfe, 0x38, 0x15, 0x9c, 0xfc, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x1d, 0x9c, 0xff, 0xcf, 0x5f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xfc, 0x25, 0x1d, 0x9c, 0xfe, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x25, 0xbc, 0xff, 0xcf, 0x5f, 0x3e, 0x00, 0x00, 0x00, 0x8e, 0xa7, 0xd6, 0x76, 0x61, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2a, 0x72, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfe, 0xf6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0x0f, 0xfe, 0x04, 0xbb, 0xfd, 0xa1, 0xff, 0xfe, 0x8f, 0x4d, 0x00, 0x00, 0x00, 0x7e, 0x7d, 0xd9, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x3d, 0xfd, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0x07, 0x45, 0xfc, 0xd9, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x15, 0x9c, 0xff, 0x3d, 0xdd, 0xd1, 0xaf, 0xff, 0x03, 0xc7, 0x54, 0x77, 0x76, 0x62, 0xcb, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x6e, 0x72, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xfe, 0x06, 0xff, 0xff, 0x17, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x57, 0x51, 0xfe, 0x49, 0xd9, 0xff, 0xfb, 0x06, 0xcf, 0x3e, 0x39, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x8e, 0x9e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x2a, 0x45, 0xfd, 0xfd, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x3d, 0xfd, 0xff, 0x4e, 0x1d, 0xff, 0xae, 0xff, 0x32, 0x00, 0x00, 0x00, 0x96, 0xcb, 0x8b, 0x87, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x77, 0x0e, 0xff, 0x13, 0x20, 0xff, 0x13, 0x20, 0xff, 0x13, 0x20, 0xff, 0x13, 0x20, 0xff, 0x13, 0x20, 0xff, 0x13, 0x20, 0xff, 0x13, 0x20, 0xff, 0x5a, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x77, 0x19, 0x00, 0x00, 0x00, 0xcf, 0x3e, 0x12, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0x9e, 0xde, 0x20, 0xb7, 0x5d, 0x0a, 0x00, 0x00, 0x00, 0xdf, 0xfb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x22, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x62, 0x63, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x88, 0x00, 0x00, 0x10, 0xc4, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x10, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x12, 0x4b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x2b, 0x0a, 0x4b, 0x08, 0x83, 0x00, 0x00, 0x3a, 0x65, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x2a, 0xa0, 0x32, 0xa3, 0x42, 0xc5, 0x29, 0xa4, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc1, 0x52, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x71, 0x18, 0xa1, 0x00, 0x20, 0x56, 0x1d, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2b, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x13, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1d, 0x39, 0x08, 0x62, 0x52, 0xaa, 0x76, 0x43, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x7e, 0x84, 0x65, 0x23, 0x42, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe3, 0x39, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xee, 0x4f, 0x00, 0x00, 0x19, 0xc8, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2d, 0xbc, 0x31, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0x2d, 0xbc, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x5b, 0xd0, 0x00, 0x00, 0x5c, 0x64, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x76, 0x62, 0x42, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xd5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0x52, 0x46, 0x08, 0x61, 0x2d, 0x7b, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x24, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x58, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x4d, 0xdb, 0x08, 0x21, 0x18, 0xc3, 0x76, 0x43, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x76, 0x61, 0x4a, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xc5, 0x2c, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xac, 0x04, 0x00, 0x00, 0x73, 0xcf, 0x25, 0xbc, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x25, 0xbc, 0x10, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x46, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x32, 0x6b, 0x08, 0x61, 0x75, 0x67, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6d, 0x65, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc1, 0x39, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa1, 0x94, 0x91, 0x00, 0x00, 0x1b, 0xf4, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x45, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1b, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x6d, 0xfb, 0x00, 0x00, 0x11, 0x01, 0x76, 0x61, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x31, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0x39, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xdd, 0x03, 0x08, 0x20, 0x42, 0x6a, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x3a, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2a, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2a, 0x09, 0x00, 0x20, 0x96, 0x4a, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x85, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xe5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc0, 0x29, 0x23, 0x00, 0x00, 0x96, 0x7c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x66, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x6d, 0xfc, 0x00, 0x00, 0x3a, 0x85, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x76, 0x43, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x8d, 0xec, 0x76, 0x43, 0x6e, 0x61, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x54, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xcd, 0x2a, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xf5, 0xc5, 0x29, 0x65, 0x19, 0x05, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1a, 0x4b, 0x73, 0xf0, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2d, 0xbc, 0x08, 0x61, 0x00, 0x00, 0x8e, 0x68, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x76, 0x62, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6d, 0xa3, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc1, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0x62, 0x42, 0x00, 0x00, 0xa6, 0x3b, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x4e, 0x1d, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x23, 0xf3, 0x00, 0x00, 0x84, 0x8e, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x6a, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x83, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0x39, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe6, 0x08, 0x21, 0x08, 0x82, 0x35, 0xbd, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x35, 0xbc, 0x31, 0xc7, 0x00, 0x20, 0x6d, 0xa3, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x85, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x83, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xe5, 0x67, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xa4, 0x08, 0x00, 0x00, 0x4c, 0x13, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1a, 0x6c, 0x00, 0x00, 0xc6, 0xf6, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xc2, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x83, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xd5, 0xb1, 0xfd, 0xe3, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xcd, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xe4, 0x00, 0x00, 0x00, 0x20, 0x56, 0x3d, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x19, 0x04, 0x31, 0x85, 0x76, 0x61, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xad, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x83, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x9c, 0x09, 0xfd, 0xc1, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0x39, 0x41, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xe6, 0x30, 0x00, 0x00, 0x22, 0xee, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0xa5, 0xd8, 0x00, 0x00, 0x43, 0x23, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x87, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x83, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x08, 0x41, 0xb4, 0x44, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0x31, 0x22, 0x00, 0x00, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0x29, 0x23, 0x18, 0xc3, 0x45, 0xdc, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1c, 0xd7, 0x00, 0x20, 0x00, 0x00, 0x76, 0x43, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x45, 0x76, 0x61, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6d, 0xa3, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x18, 0xa2, 0xfe, 0x27, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xed, 0xa7, 0x21, 0x03, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xed, 0xa6, 0x00, 0x00, 0x08, 0xe4, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x25, 0xbc, 0x42, 0x6a, 0x00, 0x00, 0x64, 0xe5, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x81, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x8d, 0x4c, 0x7e, 0x83, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x65, 0x63, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x06, 0xfd, 0xe3, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xd5, 0x8b, 0xfe, 0x90, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0x29, 0x44, 0x00, 0x00, 0x6d, 0xda, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x35, 0xdd, 0x08, 0x41, 0x3a, 0x46, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x7d, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xe9, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa1, 0xfe, 0x29, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xd5, 0x48, 0x00, 0x00, 0x32, 0x29, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2a, 0x4a, 0x00, 0x00, 0x9e, 0x8b, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x3a, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x46, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0x20, 0xc2, 0x00, 0x00, 0x14, 0x35, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x55, 0xdc, 0x00, 0x00, 0x10, 0xc2, 0x76, 0x42, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x8e, 0xa7, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa2, 0xfe, 0x49, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0x67, 0x00, 0x00, 0x5b, 0x6e, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2d, 0xdc, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x54, 0x33, 0x00, 0x00, 0x6c, 0xc8, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x5b, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe6, 0xfd, 0xc1, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0x52, 0x69, 0x00, 0x21, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x13, 0xd2, 0xae, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x45, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x76, 0x83, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x9e, 0xab, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xe7, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0x93, 0x86, 0x00, 0x00, 0x22, 0x4b, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x35, 0xdc, 0x08, 0x82, 0x00, 0x21, 0x1d, 0x19, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x53, 0xd1, 0x00, 0x00, 0x64, 0x27, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x60, 0x76, 0x62, 0x64, 0xa6, 0x10, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x46, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xf5, 0xc4, 0x08, 0x41, 0x10, 0xa2, 0x35, 0xdc, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2a, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x53, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x5b, 0x08, 0x62, 0x10, 0x82, 0x76, 0x43, 0x6e, 0x60, 0x6e, 0x60, 0x6e, 0x40, 0x65, 0xc0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x65, 0xa0, 0x7d, 0xe6, 0xb6, 0xb2, 0x18, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa2, 0xbc, 0x62, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xcc, 0x00, 0x00, 0x3b, 0xd2, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x25, 0x9c, 0x18, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x56, 0x1c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x5c, 0x74, 0x00, 0x00, 0x42, 0xc5, 0x6e, 0x60, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x47, 0xfd, 0xe3, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xed, 0x66, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xfd, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x29, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4b, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1d, 0x9c, 0x19, 0x05, 0x18, 0xc3, 0x76, 0x05, 0x6e, 0x60, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x45, 0xfd, 0xc2, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0x72, 0xe6, 0x00, 0x00, 0x3c, 0x34, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1c, 0xf8, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x5d, 0xfc, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x23, 0xb1, 0x00, 0x00, 0x3a, 0x45, 0x6e, 0x61, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb4, 0x46, 0xfd, 0xa0, 0xfd, 0xa0, 0xf5, 0xe6, 0x10, 0x82, 0x21, 0x87, 0x15, 0x7c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x1d, 0x9c, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe4, 0x1d, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x25, 0xbc, 0x31, 0xc8, 0x00, 0x00, 0x75, 0x86, 0x5d, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc4, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xfd, 0xa0, 0xb4, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0xbc, 0x63, 0xfd, 0xa1, 0x4a, 0x05, 0x00, 0x00, 0x6d, 0x79, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x2c, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x3d, 0x18, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x15, 0x9c, 0x34, 0xd8, 0x00, 0x20, 0x5b, 0x69, 0x5d, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xe6, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xfe, 0x06, 0xb5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x47, 0xd5, 0x68, 0x08, 0x21, 0x31, 0xa7, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x32, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x45, 0x45, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x3d, 0xfd, 0x4e, 0x1d, 0x21, 0x66, 0x00, 0x00, 0x53, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x61, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x18, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc2, 0x00, 0x00, 0x10, 0x82, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x10, 0xe4, 0x08, 0x41, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  /*Pixel format: Alpha 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc2, 0xf9, 0x2e, 0x00, 0xb5, 0xfa, 0x67, 0x00, 0xb5, 0xfa, 0x67, 0x00, 0xb5, 0xfa, 0x67, 0x00, 0xb5, 0xfa, 0x67, 0x00, 0xb5, 0xfa, 0x67, 0x00, 0xb5, 0xfa, 0x67, 0x00, 0xb5, 0xfa, 0x67, 0x3b, 0xbf, 0xfa, 0x64, 0xcc, 0xe6, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xdf, 0xfc, 0x59, 0xff, 0xff, 0xff, 0x01, 0xee, 0xd4, 0x90, 0x1e, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xea, 0xd4, 0x95, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe6, 0x0a, 0xe1, 0xb2, 0x1e, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xad, 0x0c, 0x67, 0xe1, 0xb0, 0x14, 0x67, 0xf3, 0xc5, 0x74, 0x16, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xdd, 0xa4, 0x5a, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x00, 0xcb, 0x68, 0x67, 0x36, 0xd2, 0x81, 0x67, 0x62, 0xdc, 0x9f, 0x65, 0x80, 0xe0, 0xab, 0x3a, 0x8e, 0xe3, 0xaa, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x07, 0xb6, 0xf9, 0xfe, 0x64, 0xcf, 0xfc, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xd5, 0xfb, 0xf4, 0x4c, 0xbd, 0xf6, 0x1b, 0xbf, 0xbf, 0x40, 0x04, 0xe6, 0xbf, 0x52, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe8, 0xc0, 0x49, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xc3, 0x6c, 0xa7, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb2, 0x19, 0xe7, 0xed, 0xc8, 0x92, 0x0e, 0xe4, 0xf6, 0xea, 0x55, 0x14, 0xcc, 0x70, 0xf8, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x1d, 0xce, 0x77, 0xff, 0x20, 0xce, 0x77, 0xca, 0xa7, 0xe9, 0xc3, 0x51, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x19, 0xbb, 0xf9, 0xff, 0x92, 0xd4, 0xfa, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xd1, 0xfa, 0xff, 0x83, 0xd8, 0xfb, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xea, 0xc4, 0x54, 0x49, 0xe0, 0xb0, 0x10, 0xfe, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb3, 0x29, 0xff, 0xf6, 0xec, 0xda, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xe2, 0xa8, 0x23, 0xe2, 0xb5, 0x24, 0xfd, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x10, 0xff, 0xf0, 0xdc, 0xa3, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x32, 0xd3, 0x84, 0xa8, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0c, 0xcb, 0x6f, 0xff, 0x58, 0xd8, 0x94, 0x6e, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x38, 0xc0, 0xfa, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x03, 0xb5, 0xf9, 0xff, 0x96, 0xd5, 0xf9, 0x55, 0xff, 0xe8, 0xd1, 0x0b, 0xe2, 0xb5, 0x26, 0xf4, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xba, 0x30, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xcf, 0x87, 0xd0, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe8, 0xc3, 0x51, 0xf0, 0xff, 0xff, 0xcc, 0x05, 0xe2, 0xff, 0xeb, 0x1a, 0x14, 0xcd, 0x73, 0xfb, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xff, 0x81, 0xe1, 0xb0, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7b, 0xd3, 0xfb, 0xc7, 0xe6, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x2d, 0xbd, 0xf9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xf7, 0xeb, 0x7d, 0xe1, 0xb2, 0x1c, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb4, 0x22, 0xff, 0xf4, 0xde, 0x90, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xc9, 0x76, 0x34, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0xea, 0xca, 0x79, 0x61, 0xe8, 0xff, 0xe8, 0x0b, 0x46, 0xd3, 0x88, 0xcf, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x33, 0xd2, 0x83, 0xd1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x08, 0xb6, 0xf9, 0xfe, 0x5b, 0xc8, 0xfa, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x06, 0xb5, 0xf9, 0xfd, 0xe9, 0xf5, 0xfd, 0x98, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xb2, 0x1d, 0xb2, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xb8, 0x45, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xd1, 0x7e, 0xe9, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe9, 0xca, 0x6f, 0xed, 0xff, 0x80, 0x80, 0x02, 0x30, 0xcf, 0x83, 0x25, 0x08, 0xcb, 0x6d, 0xfe, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x03, 0xca, 0x6a, 0xff, 0xb1, 0xe7, 0xc0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x10, 0xb8, 0xf9, 0xff, 0x70, 0xce, 0xfb, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x21, 0xbc, 0xf9, 0xda, 0x99, 0xcc, 0xff, 0x05, 0xf6, 0xe6, 0xc5, 0x53, 0xe0, 0xb0, 0x13, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xed, 0xd5, 0x87, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xd3, 0x9d, 0x51, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x12, 0xfe, 0xee, 0xd4, 0x88, 0x4d, 0xff, 0xff, 0xff, 0x04, 0x57, 0xd8, 0x95, 0xeb, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x7d, 0xe0, 0xac, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x41, 0xc2, 0xf9, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x02, 0xb6, 0xf9, 0xfe, 0x96, 0xde, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xda, 0x95, 0xeb, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe8, 0xc4, 0x61, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xe0, 0xb2, 0x1b, 0xc6, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe8, 0xc6, 0x72, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd6, 0x92, 0x5e, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x19, 0xcd, 0x73, 0xf8, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x72, 0xd8, 0x97, 0xdf, 0x6d, 0xd6, 0x94, 0xdf, 0x15, 0xce, 0x74, 0xf3, 0x04, 0xca, 0x6a, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x1c, 0xcb, 0x70, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x68, 0xce, 0xfb, 0xcb, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x29, 0xba, 0xf9, 0xf8, 0xee, 0xf9, 0xff, 0x2c, 0xe8, 0xc5, 0x7a, 0x2c, 0xe0, 0xaf, 0x0f, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xb7, 0x3e, 0x63, 0xf7, 0xec, 0xd3, 0x85, 0xe0, 0xb0, 0x16, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xb7, 0x29, 0xfc, 0xeb, 0xd8, 0x9d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x43, 0xd7, 0x8f, 0xf2, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xd6, 0x92, 0x4b, 0x13, 0xcd, 0x73, 0xfd, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x1a, 0xce, 0x77, 0xdb, 0xcc, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x05, 0xb6, 0xf9, 0xff, 0x40, 0xbf, 0xf9, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x1c, 0xba, 0xfa, 0x64, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe0, 0xb8, 0xe1, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe6, 0xc0, 0x49, 0xff, 0xe0, 0xb1, 0x16, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xb9, 0x2d, 0xae, 0x00, 0x00, 0x00, 0x00, 0xae, 0xe7, 0xc4, 0xa0, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xd8, 0x97, 0xcb, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0xcd, 0x73, 0xdb, 0x99, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x0c, 0xb7, 0xf9, 0xff, 0x62, 0xcc, 0xfb, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x2e, 0xbf, 0xf9, 0xfb, 0xcc, 0xff, 0xff, 0x05, 0xf0, 0xe1, 0xa5, 0x11, 0xe4, 0xb9, 0x2f, 0xfc, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb5, 0x2e, 0xff, 0xf7, 0xee, 0xd9, 0x3d, 0x6d, 0xb6, 0x92, 0x07, 0x1b, 0xcd, 0x74, 0xe2, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xd9, 0x92, 0x85, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0xcd, 0x73, 0xdb, 0x99, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x13, 0xb8, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x42, 0xc1, 0xf9, 0xe4, 0xc9, 0xe4, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x60, 0xc5, 0xfa, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xc2, 0x70, 0xa4, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe5, 0xb9, 0x35, 0x6a, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xf2, 0xdb, 0xe5, 0x01, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xd1, 0x80, 0x6a, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0xcd, 0x73, 0xdb, 0x99, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x9e, 0xd9, 0xfd, 0xd4, 0x1a, 0xbb, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x64, 0xcd, 0xfb, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x1c, 0xbc, 0xf9, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xaa, 0x03, 0xe7, 0xc3, 0x52, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xf0, 0xdb, 0xaf, 0x23, 0xcb, 0xec, 0xd4, 0x36, 0x08, 0xcb, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xe2, 0xaf, 0xcb, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0xcd, 0x73, 0xdb, 0x99, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x76, 0xcd, 0xfa, 0x9e, 0x08, 0xb6, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x05, 0xb5, 0xf9, 0xff, 0x1c, 0xb9, 0xf6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x8e, 0xd6, 0xfb, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xc3, 0x4a, 0x78, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x12, 0xff, 0xf7, 0xed, 0xd1, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xd1, 0x7d, 0x7a, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xd3, 0x85, 0xd6, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0xcd, 0x73, 0xdb, 0x99, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0xff, 0xff, 0xff, 0x0a, 0x32, 0xc1, 0xfb, 0xb2, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x09, 0xb7, 0xf9, 0xfb, 0x50, 0xc5, 0xfa, 0x30, 0x00, 0x00, 0x00, 0x00, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x07, 0xb6, 0xf9, 0xfb, 0x88, 0xd2, 0xff, 0x2d, 0xff, 0xf5, 0xeb, 0x1a, 0xe3, 0xb8, 0x42, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb2, 0x18, 0xd6, 0xff, 0xbf, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x16, 0xcc, 0x72, 0xfa, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xd9, 0x9e, 0x57, 0x08, 0xcb, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x18, 0xce, 0x76, 0xdb, 0xcc, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x90, 0xd3, 0xf4, 0x17, 0x34, 0xc2, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x35, 0xbe, 0xfa, 0xee, 0xa8, 0xdb, 0xf8, 0x23, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x33, 0xc0, 0xfa, 0xee, 0xff, 0xff, 0xff, 0x02, 0xe3, 0xba, 0x4c, 0x25, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb2, 0x1e, 0xff, 0xf6, 0xe9, 0xcb, 0x53, 0x00, 0x00, 0x00, 0x00, 0x36, 0xcf, 0x7e, 0xc1, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x06, 0xcb, 0x6c, 0xdb, 0x0a, 0xc9, 0x6c, 0x50, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x07, 0xcb, 0x6c, 0x4e, 0x88, 0xe5, 0xb6, 0xba, 0x18, 0xce, 0x74, 0xfd, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x21, 0xce, 0x78, 0xd2, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xdf, 0xfb, 0x48, 0x14, 0xba, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x64, 0xcf, 0xfb, 0xd8, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x03, 0xb5, 0xf9, 0xff, 0xb5, 0xe3, 0xf9, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xcc, 0x70, 0xe4, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe4, 0xba, 0x31, 0xfc, 0xff, 0xff, 0xdf, 0x08, 0x97, 0xe3, 0xb7, 0x51, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x67, 0xda, 0x9c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd2, 0xfc, 0x94, 0x0c, 0xb6, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x05, 0xb5, 0xf9, 0xff, 0x4b, 0xc4, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x4c, 0xc6, 0xfa, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xef, 0xd6, 0x99, 0x50, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xeb, 0xcd, 0x76, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xdb, 0x9d, 0xf3, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x7c, 0xdf, 0xa6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x43, 0xc1, 0xfb, 0xb2, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x03, 0xb5, 0xf9, 0xff, 0x95, 0xdc, 0xf6, 0x1d, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xb1, 0x19, 0xc2, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe6, 0xbe, 0x50, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xeb, 0xba, 0x1a, 0x13, 0xcc, 0x70, 0xf8, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x39, 0xd3, 0x86, 0xff, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xdb, 0xf3, 0x15, 0x48, 0xc8, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x53, 0xc8, 0xf9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe3, 0xbd, 0x77, 0xe0, 0xb0, 0x15, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb6, 0x29, 0xff, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xed, 0xd2, 0x83, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x58, 0xd7, 0x95, 0xb4, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x61, 0xdb, 0x9c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xe5, 0xff, 0x44, 0x09, 0xb8, 0xf9, 0xfe, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xd4, 0xed, 0xfc, 0x53, 0xcc, 0xcc, 0x99, 0x05, 0xe0, 0xb0, 0x1b, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb2, 0x14, 0xa8, 0xf2, 0xe1, 0xb9, 0xed, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe6, 0xbd, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xce, 0x73, 0xfe, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x54, 0xd9, 0x95, 0xfc, 0xdb, 0xff, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xd4, 0xfa, 0x70, 0x0c, 0xb6, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x59, 0xc6, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xc1, 0x4f, 0x5e, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb6, 0x30, 0xff, 0xe3, 0xc6, 0x8e, 0x12, 0xff, 0xd4, 0x55, 0x06, 0xe2, 0xb2, 0x1a, 0xe1, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0xec, 0xd0, 0x8c, 0x92, 0x00, 0x00, 0x00, 0x00, 0x60, 0xd8, 0x98, 0x9c, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0e, 0xcb, 0x6e, 0xff, 0x48, 0xd7, 0x90, 0xae, 0x9f, 0xea, 0xbf, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xc1, 0xfb, 0xb6, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x21, 0xbd, 0xf9, 0xf7, 0x8b, 0xd1, 0xff, 0x0b, 0xf2, 0xf2, 0xd7, 0x13, 0xe2, 0xb6, 0x31, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe7, 0xc4, 0x4e, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xce, 0x87, 0xa8, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xf4, 0xee, 0xcc, 0x66, 0x0f, 0xdd, 0xff, 0xdd, 0x0f, 0x19, 0xcc, 0x73, 0xfc, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xfa, 0x00, 0xca, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x00, 0xc9, 0x68, 0xe8, 0x35, 0xcf, 0x7c, 0xe8, 0x9f, 0xe6, 0xbe, 0xe8, 0x99, 0xe6, 0xb2, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xe6, 0xff, 0x14, 0x18, 0xba, 0xf8, 0xbf, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x87, 0xd9, 0xfb, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xc4, 0x5a, 0x9c, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x1f, 0xff, 0xf0, 0xe0, 0xb9, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xea, 0x0c, 0xe6, 0xc2, 0x4d, 0xf9, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0xec, 0xcf, 0x7e, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xd9, 0x9c, 0x6a, 0x03, 0xca, 0x6a, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xe2, 0xfc, 0x50, 0x14, 0xba, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x2c, 0xbc, 0xfa, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x80, 0x02, 0xe4, 0xba, 0x39, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x12, 0xff, 0xef, 0xd6, 0x98, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xbc, 0x50, 0x63, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x16, 0xff, 0xec, 0xd2, 0x93, 0x28, 0xcc, 0xf5, 0xd6, 0x19, 0x25, 0xcf, 0x79, 0xed, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x78, 0xd0, 0xfc, 0x57, 0x0f, 0xb7, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x66, 0xcc, 0xfb, 0x73, 0xff, 0xff, 0xff, 0x01, 0xe5, 0xbe, 0x53, 0xb0, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xb5, 0x23, 0xdc, 0xff, 0xff, 0x99, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xdb, 0x07, 0xe7, 0xc3, 0x57, 0xf7, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe3, 0xba, 0x36, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x79, 0xde, 0xa4, 0x54, 0x05, 0xca, 0x6b, 0xff, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x46, 0xc3, 0xfb, 0xb2, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x32, 0xc1, 0xfa, 0xf8, 0xf1, 0xff, 0xff, 0x12, 0xf1, 0xdb, 0x9b, 0x38, 0xe1, 0xb1, 0x13, 0xfc, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x14, 0xff, 0xf4, 0xe6, 0xc6, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xba, 0x3e, 0x25, 0xe1, 0xb1, 0x15, 0xfe, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb2, 0x21, 0xff, 0xf7, 0xe6, 0xc5, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x38, 0xd2, 0x84, 0xd6, 0x0a, 0xcb, 0x6d, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xc3, 0xf8, 0x72, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0xac, 0xdc, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xee, 0xff, 0x0f, 0x22, 0xbe, 0xfb, 0xbb, 0x06, 0xb5, 0xf9, 0xff, 0x7b, 0xd1, 0xfc, 0x4d, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xcc, 0x77, 0xd9, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe4, 0xbc, 0x3b, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0xdb, 0x07, 0xe3, 0xba, 0x43, 0xd9, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe4, 0xb8, 0x38, 0xd1, 0xff, 0xff, 0xaa, 0x03, 0xa1, 0xe7, 0xbf, 0x77, 0x0e, 0xcb, 0x6f, 0xcb, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xcc, 0xfb, 0x72, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0xba, 0xe1, 0xfc, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xe6, 0xfc, 0x51, 0x44, 0xc7, 0xfa, 0xd9, 0xd4, 0xff, 0xff, 0x06, 0xf2, 0xe4, 0xc5, 0x39, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xee, 0xd1, 0x8b, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xed, 0xd4, 0x2a, 0xe5, 0xbd, 0x3f, 0xfd, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe6, 0xbf, 0x48, 0xff, 0xf5, 0xdb, 0xa8, 0x32, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xd7, 0x8f, 0x8b, 0x80, 0xff, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xed, 0xff, 0x0e, 0x97, 0xdf, 0xff, 0x20, 0x97, 0xdf, 0xff, 0x20, 0x97, 0xdf, 0xff, 0x20, 0x97, 0xdf, 0xff, 0x20, 0x97, 0xdf, 0xff, 0x20, 0x97, 0xdf, 0xff, 0x20, 0x97, 0xdf, 0xff, 0x20, 0xd3, 0xe9, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xeb, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xe3, 0xc6, 0x12, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xd7, 0x9f, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xef, 0xd7, 0x97, 0x20, 0xe6, 0xe6, 0xb3, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x23, 0x2d, 0xff, 0x00, 0x49, 0x65, 0xff, 0x00, 0x49, 0x65, 0xff, 0x00, 0x49, 0x65, 0xff, 0x00, 0x49, 0x65, 0xff, 0x00, 0x49, 0x65, 0xff, 0x00, 0x49, 0x65, 0xff, 0x00, 0x49, 0x65, 0xff, 0x17, 0x4b, 0x62, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x4e, 0x58, 0xff, 0x01, 0x01, 0x01, 0xff, 0x1c, 0x19, 0x11, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x16, 0x14, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x09, 0xff, 0x5b, 0x48, 0x0c, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x46, 0x05, 0xff, 0x5b, 0x47, 0x08, 0xff, 0x15, 0x11, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x27, 0x4e, 0x3a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x00, 0x52, 0x2a, 0xff, 0x16, 0x55, 0x34, 0xff, 0x27, 0x57, 0x3f, 0xff, 0x1d, 0x33, 0x27, 0xff, 0x05, 0x08, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x07, 0xb5, 0xf8, 0xff, 0x1f, 0x40, 0x4e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8b, 0xcc, 0xf0, 0xff, 0x08, 0x14, 0x1a, 0xff, 0x03, 0x03, 0x01, 0xff, 0xe6, 0xbf, 0x52, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x79, 0x64, 0x26, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x97, 0x80, 0x47, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xcc, 0xa1, 0x17, 0xff, 0x0d, 0x0b, 0x08, 0xff, 0x4c, 0x52, 0x4e, 0xff, 0x13, 0xc6, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x1d, 0xce, 0x77, 0xff, 0x19, 0xa3, 0x5e, 0xff, 0x35, 0x4a, 0x3e, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x19, 0xbb, 0xf9, 0xff, 0x1f, 0x2d, 0x35, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x81, 0xd1, 0xfa, 0xff, 0x79, 0xc7, 0xe7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x43, 0x38, 0x18, 0xff, 0xdf, 0xaf, 0x10, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb3, 0x29, 0xff, 0x35, 0x33, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x22, 0x1f, 0x17, 0xff, 0xe0, 0xb4, 0x24, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x10, 0xff, 0x83, 0x78, 0x59, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x8b, 0x57, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0c, 0xcb, 0x6f, 0xff, 0x26, 0x5d, 0x40, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x2f, 0xa2, 0xd3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x03, 0xb5, 0xf9, 0xff, 0x32, 0x47, 0x53, 0xff, 0x0b, 0x0a, 0x09, 0xff, 0xd8, 0xad, 0x24, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xaa, 0x8b, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc1, 0xa9, 0x6e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xda, 0xb8, 0x4c, 0xff, 0x05, 0x05, 0x04, 0xff, 0x17, 0x1a, 0x18, 0xff, 0x14, 0xca, 0x71, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0a, 0xcb, 0x6d, 0xff, 0x34, 0x5b, 0x47, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x60, 0xa5, 0xc4, 0xff, 0x09, 0x0a, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x1f, 0x82, 0xab, 0xff, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x79, 0x73, 0xff, 0xe1, 0xb2, 0x1c, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb4, 0x22, 0xff, 0x16, 0x14, 0x0d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x30, 0x29, 0x18, 0xff, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0x59, 0x4d, 0x2e, 0xff, 0x0a, 0x0b, 0x0a, 0xff, 0x39, 0xab, 0x6e, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x2a, 0xac, 0x6b, 0xff, 0x03, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x08, 0xb5, 0xf8, 0xff, 0x14, 0x2c, 0x37, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x06, 0xb4, 0xf7, 0xff, 0x8b, 0x92, 0x97, 0xff, 0x00, 0x00, 0x00, 0xff, 0x9d, 0x7c, 0x14, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xd1, 0xaa, 0x40, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xbf, 0x73, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xd9, 0xbc, 0x67, 0xff, 0x02, 0x01, 0x01, 0xff, 0x07, 0x1e, 0x13, 0xff, 0x08, 0xca, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x03, 0xca, 0x6a, 0xff, 0x2d, 0x3b, 0x31, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x10, 0xb8, 0xf9, 0xff, 0x19, 0x2e, 0x38, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x1c, 0xa1, 0xd5, 0xff, 0x03, 0x04, 0x05, 0xff, 0x50, 0x4b, 0x40, 0xff, 0xe0, 0xb0, 0x13, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x5b, 0x52, 0x34, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4b, 0x43, 0x32, 0xff, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xdf, 0xaf, 0x12, 0xff, 0x48, 0x40, 0x29, 0xff, 0x04, 0x04, 0x04, 0xff, 0x50, 0xc7, 0x89, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x5e, 0xa8, 0x81, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x3b, 0xaf, 0xe1, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x02, 0xb5, 0xf8, 0xff, 0x17, 0x22, 0x27, 0xff, 0x00, 0x00, 0x00, 0xff, 0xde, 0xc9, 0x89, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe6, 0xc2, 0x60, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x00, 0xff, 0xae, 0x8a, 0x15, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xdc, 0xbc, 0x6c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x26, 0x4f, 0x36, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x18, 0xc7, 0x70, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x64, 0xbd, 0x84, 0xff, 0x5f, 0xbb, 0x81, 0xff, 0x14, 0xc4, 0x6f, 0xff, 0x04, 0xca, 0x6a, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0x98, 0x54, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x53, 0xa4, 0xc8, 0xff, 0x05, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x28, 0xb5, 0xf2, 0xff, 0x29, 0x2b, 0x2c, 0xff, 0x28, 0x22, 0x15, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x58, 0x47, 0x18, 0xff, 0x81, 0x7b, 0x6e, 0xff, 0xe0, 0xb0, 0x16, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb5, 0x29, 0xff, 0x0c, 0x0b, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x40, 0xcc, 0x88, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x3f, 0x2b, 0xff, 0x13, 0xcb, 0x72, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x16, 0xb1, 0x66, 0xff, 0x04, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x05, 0xb6, 0xf9, 0xff, 0x0a, 0x1e, 0x27, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x0b, 0x49, 0x62, 0xff, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xc6, 0xa2, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe6, 0xc0, 0x49, 0xff, 0xe0, 0xb1, 0x16, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x9b, 0x7e, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6d, 0x91, 0x7b, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4a, 0xac, 0x78, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x12, 0xb0, 0x63, 0xff, 0x03, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x0c, 0xb7, 0xf9, 0xff, 0x17, 0x30, 0x3b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x2d, 0xbc, 0xf5, 0xff, 0x04, 0x05, 0x05, 0xff, 0x10, 0x0f, 0x0b, 0xff, 0xe1, 0xb7, 0x2e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb5, 0x2e, 0xff, 0x3b, 0x39, 0x34, 0xff, 0x03, 0x05, 0x04, 0xff, 0x18, 0xb6, 0x67, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x25, 0x71, 0x4c, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x12, 0xb0, 0x63, 0xff, 0x03, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x13, 0xb8, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x3b, 0xad, 0xdf, 0xff, 0x0f, 0x11, 0x13, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x3f, 0x82, 0xa5, 0xff, 0x00, 0x00, 0x00, 0xff, 0x95, 0x7d, 0x48, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x5f, 0x4d, 0x16, 0xff, 0x00, 0x00, 0x00, 0xff, 0xb2, 0xd9, 0xc5, 0xff, 0x01, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x10, 0x57, 0x35, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x12, 0xb0, 0x63, 0xff, 0x03, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x83, 0xb4, 0xd2, 0xff, 0x1a, 0xbb, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x50, 0xa5, 0xca, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x1c, 0xbb, 0xf7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x02, 0xff, 0xe7, 0xc3, 0x52, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x21, 0x1e, 0x18, 0xff, 0x2b, 0x32, 0x2d, 0xff, 0x08, 0xcb, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x64, 0xb4, 0x8b, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x12, 0xb0, 0x63, 0xff, 0x03, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x49, 0x7f, 0x9b, 0xff, 0x08, 0xb6, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x05, 0xb5, 0xf9, 0xff, 0x06, 0x28, 0x35, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x80, 0xc1, 0xe2, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6d, 0x5c, 0x23, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x12, 0xff, 0xc1, 0xb9, 0xa3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x15, 0x64, 0x3c, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x35, 0xb1, 0x70, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x12, 0xb0, 0x63, 0xff, 0x03, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x23, 0x87, 0xaf, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x09, 0xb4, 0xf5, 0xff, 0x0f, 0x25, 0x2f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x07, 0xb3, 0xf5, 0xff, 0x18, 0x25, 0x2d, 0xff, 0x1a, 0x19, 0x18, 0xff, 0xe3, 0xb8, 0x42, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xbd, 0x95, 0x14, 0xff, 0x04, 0x03, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x16, 0xc8, 0x70, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x4a, 0x36, 0xff, 0x08, 0xcb, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x15, 0xb1, 0x65, 0xff, 0x04, 0x05, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x13, 0x16, 0xff, 0x34, 0xc2, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x31, 0xb1, 0xe9, 0xff, 0x17, 0x1e, 0x22, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x30, 0xb3, 0xe9, 0xff, 0x02, 0x02, 0x02, 0xff, 0x21, 0x1b, 0x0b, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb2, 0x1e, 0xff, 0x50, 0x4c, 0x42, 0xff, 0x00, 0x00, 0x00, 0xff, 0x29, 0x9d, 0x5f, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x05, 0xae, 0x5d, 0xff, 0x03, 0x3f, 0x22, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x02, 0x3e, 0x21, 0xff, 0x63, 0xa7, 0x85, 0xff, 0x18, 0xcc, 0x73, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x1b, 0xaa, 0x63, 0xff, 0x03, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x3f, 0x47, 0xff, 0x14, 0xba, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x55, 0xaf, 0xd5, 0xff, 0x80, 0xd1, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x03, 0xb5, 0xf9, 0xff, 0x20, 0x28, 0x2c, 0xff, 0x00, 0x00, 0x00, 0xff, 0xd2, 0xb6, 0x64, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb8, 0x30, 0xff, 0x08, 0x08, 0x07, 0xff, 0x30, 0x48, 0x3a, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x01, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x4d, 0xa3, 0x75, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x49, 0x7a, 0x92, 0xff, 0x0c, 0xb6, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x05, 0xb5, 0xf9, 0xff, 0x4b, 0xc4, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x40, 0xa8, 0xd4, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4b, 0x43, 0x30, 0xff, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x54, 0x49, 0x2a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x5a, 0xd1, 0x96, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x27, 0x46, 0x34, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x2f, 0x87, 0xaf, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x03, 0xb5, 0xf9, 0xff, 0x11, 0x19, 0x1c, 0xff, 0x00, 0x00, 0x00, 0xff, 0xab, 0x87, 0x13, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xdc, 0xb6, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x18, 0x13, 0xff, 0x12, 0xc6, 0x6d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x39, 0xd3, 0x86, 0xff, 0x04, 0x04, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x12, 0x14, 0xff, 0x48, 0xc8, 0xfa, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x3b, 0x8e, 0xb1, 0xff, 0x00, 0x00, 0x00, 0xff, 0x72, 0x6a, 0x58, 0xff, 0xe0, 0xb0, 0x15, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb6, 0x29, 0xff, 0xe0, 0xaf, 0x11, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x95, 0x84, 0x52, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x98, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x36, 0x7a, 0x57, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x3d, 0x44, 0xff, 0x09, 0xb7, 0xf8, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x45, 0x4d, 0x52, 0xff, 0x04, 0x04, 0x03, 0xff, 0xe0, 0xb0, 0x1b, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x95, 0x75, 0x0d, 0xff, 0xe1, 0xd1, 0xac, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xd8, 0xb2, 0x3d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0xcd, 0x73, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x53, 0xd6, 0x93, 0xff, 0x06, 0x07, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x36, 0x5d, 0x6e, 0xff, 0x0c, 0xb6, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x32, 0x70, 0x8e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x55, 0x47, 0x1d, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe2, 0xb6, 0x30, 0xff, 0x10, 0x0e, 0x0a, 0xff, 0x06, 0x05, 0x02, 0xff, 0xc7, 0x9d, 0x17, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0x87, 0x77, 0x50, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3b, 0x84, 0x5d, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x0e, 0xcb, 0x6e, 0xff, 0x31, 0x93, 0x62, 0xff, 0x0f, 0x16, 0x12, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x8a, 0xb3, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x20, 0xb7, 0xf1, 0xff, 0x06, 0x09, 0x0b, 0xff, 0x12, 0x12, 0x10, 0xff, 0xe2, 0xb6, 0x31, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x6a, 0x5a, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x9b, 0x88, 0x59, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xd6, 0xa7, 0x0e, 0xff, 0x0e, 0x0c, 0x06, 0xff, 0x0d, 0x0f, 0x0d, 0xff, 0x19, 0xca, 0x72, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xca, 0x69, 0xff, 0x00, 0xc6, 0x67, 0xff, 0x00, 0xb8, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x00, 0xb7, 0x5f, 0xff, 0x30, 0xbc, 0x71, 0xff, 0x91, 0xd1, 0xad, 0xff, 0x12, 0x1b, 0x15, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x12, 0x14, 0xff, 0x12, 0x8b, 0xba, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x5f, 0x99, 0xb1, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8e, 0x78, 0x37, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x1f, 0xff, 0x1f, 0x1d, 0x18, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0b, 0xff, 0xe1, 0xbd, 0x4b, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0f, 0xff, 0x9d, 0x8a, 0x54, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2c, 0x5a, 0x41, 0xff, 0x03, 0xca, 0x6a, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x47, 0x4f, 0xff, 0x14, 0xba, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x29, 0xae, 0xe7, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0xff, 0xe4, 0xba, 0x39, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x12, 0xff, 0x3a, 0x34, 0x25, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x59, 0x49, 0x1f, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xb0, 0x16, 0xff, 0x25, 0x21, 0x17, 0xff, 0x14, 0x18, 0x15, 0xff, 0x22, 0xc0, 0x70, 0xff, 0x00, 0xca, 0x69, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x29, 0x47, 0x56, 0xff, 0x0f, 0xb7, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x2e, 0x5c, 0x71, 0xff, 0x01, 0x01, 0x01, 0xff, 0x9e, 0x83, 0x39, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xc4, 0x9c, 0x1e, 0xff, 0x05, 0x05, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x06, 0xff, 0xe0, 0xbd, 0x54, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x8a, 0x71, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x28, 0x49, 0x36, 0xff, 0x05, 0xca, 0x6b, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0x31, 0x88, 0xaf, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x31, 0xbc, 0xf3, 0xff, 0x11, 0x12, 0x12, 0xff, 0x35, 0x30, 0x22, 0xff, 0xde, 0xaf, 0x13, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x14, 0xff, 0x89, 0x81, 0x6f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0x1b, 0x09, 0xff, 0xe0, 0xb0, 0x15, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe1, 0xb2, 0x21, 0xff, 0x3c, 0x38, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x2f, 0xb0, 0x6f, 0xff, 0x08, 0xa2, 0x57, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x23, 0x57, 0x6f, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x00, 0xb5, 0xf9, 0xff, 0x7a, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0e, 0x0f, 0xff, 0x19, 0x8b, 0xb8, 0xff, 0x06, 0xb5, 0xf9, 0xff, 0x25, 0x3f, 0x4c, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xae, 0x65, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0x9f, 0x83, 0x29, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x06, 0x06, 0xff, 0xc1, 0x9e, 0x39, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xe0, 0xaf, 0x0e, 0xff, 0xbb, 0x97, 0x2e, 0xff, 0x03, 0x03, 0x02, 0xff, 0x4b, 0x6c, 0x59, 0xff, 0x0b, 0xa2, 0x58, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0x5b, 0x70, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x30, 0xc1, 0xf9, 0xff, 0x84, 0xa0, 0xb3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x49, 0x50, 0xff, 0x3a, 0xa9, 0xd5, 0xff, 0x05, 0x06, 0x06, 0xff, 0x36, 0x33, 0x2c, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0x52, 0x48, 0x30, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x29, 0x27, 0x23, 0xff, 0xe3, 0xbc, 0x3f, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe5, 0xbc, 0x3b, 0xff, 0xe6, 0xbf, 0x48, 0xff, 0x30, 0x2b, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x31, 0x75, 0x4e, 0xff, 0x01, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0d, 0x0e, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x1c, 0x20, 0xff, 0x13, 0x15, 0x17, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x17, 0x19, 0xff, 0x00, 0x00, 0x00, 0xff, 0x11, 0x10, 0x0e, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x04, 0x04, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x1b, 0x14, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x1e, 0x1b, 0x13, 0xff, 0x09, 0x09, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x07, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
 #endif
 };
 
 const lv_img_dsc_t _nxp_alpha_100x50 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_TRUE_COLOR,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 100,
   .header.h = 50,
-  .data_size = 5000 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = 5000 * LV_COLOR_SIZE / 8,
   .data = _nxp_alpha_100x50_map,
 };
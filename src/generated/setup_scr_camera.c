@@ -19,6 +19,7 @@ void setup_scr_camera(lv_ui *ui)
 {
 	//Write codes camera
 	ui->camera = lv_obj_create(NULL);
+	ui->camera_del = false;
 	lv_obj_set_size(ui->camera, 800, 480);
 
 	//Write style for camera, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
@@ -47,25 +48,16 @@ void setup_scr_camera(lv_ui *ui)
 	lv_obj_set_style_text_font(ui->camera_btn_back, &lv_font_montserratMedium_16, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->camera_btn_back, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN|LV_STATE_DEFAULT);
 
-	//Write codes camera_img_display
-	ui->camera_img_display = lv_img_create(ui->camera);
-	lv_obj_add_flag(ui->camera_img_display, LV_OBJ_FLAG_CLICKABLE);
-	lv_img_set_pivot(ui->camera_img_display, 50,50);
-	lv_img_set_angle(ui->camera_img_display, 0);
-	lv_obj_set_pos(ui->camera_img_display, 116, 0);
-	lv_obj_set_size(ui->camera_img_display, 640, 480);
+	//Write codes camera_video
+	ui->camera_video = video_view_create(ui->camera);
+	lv_obj_add_flag(ui->camera_video, LV_OBJ_FLAG_CLICKABLE);
+	lv_obj_set_pos(ui->camera_video, 116, 0);
+	lv_obj_set_size(ui->camera_video, 640, 480);
 
-	//Write style for camera_img_display, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_img_opa(ui->camera_img_display, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-
-	//Write codes camera_canvas_boxes
-	ui->camera_canvas_boxes = lv_canvas_create(ui->camera);
-	static lv_color_t buf_camera_canvas_boxes[640*480*4];
-	lv_canvas_set_buffer(ui->camera_canvas_boxes, buf_camera_canvas_boxes, 640, 480, LV_IMG_CF_TRUE_COLOR_ALPHA);
-	lv_canvas_fill_bg(ui->camera_canvas_boxes, lv_color_hex(0xffffff), 0);
-	lv_obj_set_pos(ui->camera_canvas_boxes, 116, 0);
-	lv_obj_set_size(ui->camera_canvas_boxes, 640, 480);
-	lv_obj_set_scrollbar_mode(ui->camera_canvas_boxes, LV_SCROLLBAR_MODE_OFF);
+	//Write codes camera_box_overlay
+	ui->camera_box_overlay = box_overlay_create(ui->camera);
+	lv_obj_set_pos(ui->camera_box_overlay, 116, 0);
+	lv_obj_set_size(ui->camera_box_overlay, 640, 480);
 
 	//Write codes camera_img_logo
 	ui->camera_img_logo = lv_img_create(ui->camera);
@@ -19,6 +19,7 @@ void setup_scr_screen(lv_ui *ui)
 {
 	//Write codes screen
 	ui->screen = lv_obj_create(NULL);
+	ui->screen_del = false;
 	lv_obj_set_size(ui->screen, 800, 480);
 
 	//Write style for screen, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
@@ -45,20 +46,23 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_label_Date, 206, 221);
 
 	//Write style for screen_label_Date, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_border_width(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_color(ui->screen_label_Date, lv_color_hex(0xffffff), LV_PART_MAIN|LV_STATE_DEFAULT);
+	static lv_style_t style_screen_shared_0;
+	ui_init_style(&style_screen_shared_0);
+	lv_style_set_border_width(&style_screen_shared_0, 0);
+	lv_style_set_radius(&style_screen_shared_0, 0);
+	lv_style_set_text_color(&style_screen_shared_0, lv_color_hex(0xffffff));
+	lv_style_set_text_letter_space(&style_screen_shared_0, 2);
+	lv_style_set_text_line_space(&style_screen_shared_0, 0);
+	lv_style_set_pad_top(&style_screen_shared_0, 0);
+	lv_style_set_pad_right(&style_screen_shared_0, 0);
+	lv_style_set_pad_bottom(&style_screen_shared_0, 0);
+	lv_style_set_pad_left(&style_screen_shared_0, 0);
+	lv_style_set_shadow_width(&style_screen_shared_0, 0);
+	lv_obj_add_style(ui->screen_label_Date, &style_screen_shared_0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_font(ui->screen_label_Date, &lv_font_montserratMedium_20, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_letter_space(ui->screen_label_Date, 2, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_line_space(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->screen_label_Date, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_opa(ui->screen_label_Date, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_color(ui->screen_label_Date, lv_color_hex(0x262626), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_top(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_right(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_bottom(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_left(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_label_Date, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 
 	//Write codes screen_label_Time
 	ui->screen_label_Time = lv_label_create(ui->screen);
@@ -68,19 +72,10 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_label_Time, 192, 76);
 
 	//Write style for screen_label_Time, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_border_width(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_color(ui->screen_label_Time, lv_color_hex(0xffffff), LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_label_Time, &style_screen_shared_0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_font(ui->screen_label_Time, &lv_font_montserratMedium_60, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_letter_space(ui->screen_label_Time, 2, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_line_space(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->screen_label_Time, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_opa(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_top(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_right(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_bottom(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_left(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_label_Time, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 
 	//Write codes screen_btn_temp
 	ui->screen_btn_temp = lv_btn_create(ui->screen);
@@ -93,13 +88,16 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_btn_temp, 230, 160);
 
 	//Write style for screen_btn_temp, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_bg_opa(ui->screen_btn_temp, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_color(ui->screen_btn_temp, lv_color_hex(0x262626), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_border_width(ui->screen_btn_temp, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_btn_temp, 5, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_btn_temp, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
+	static lv_style_t style_screen_shared_1;
+	ui_init_style(&style_screen_shared_1);
+	lv_style_set_bg_opa(&style_screen_shared_1, 255);
+	lv_style_set_bg_color(&style_screen_shared_1, lv_color_hex(0x262626));
+	lv_style_set_border_width(&style_screen_shared_1, 0);
+	lv_style_set_radius(&style_screen_shared_1, 5);
+	lv_style_set_shadow_width(&style_screen_shared_1, 0);
+	lv_style_set_bg_img_opa(&style_screen_shared_1, 255);
+	lv_obj_add_style(ui->screen_btn_temp, &style_screen_shared_1, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_img_src(ui->screen_btn_temp, &_btn_temp_230x160, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_img_opa(ui->screen_btn_temp, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_color(ui->screen_btn_temp, lv_color_hex(0xffffff), LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_font(ui->screen_btn_temp, &lv_font_montserratMedium_45, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->screen_btn_temp, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN|LV_STATE_DEFAULT);
@@ -115,13 +113,8 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_btn_light_on, 230, 160);
 
 	//Write style for screen_btn_light_on, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_bg_opa(ui->screen_btn_light_on, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_color(ui->screen_btn_light_on, lv_color_hex(0x262626), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_border_width(ui->screen_btn_light_on, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_btn_light_on, 5, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_btn_light_on, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_btn_light_on, &style_screen_shared_1, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_img_src(ui->screen_btn_light_on, &_img_light_on_230x160, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_img_opa(ui->screen_btn_light_on, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_color(ui->screen_btn_light_on, lv_color_hex(0x000000), LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_font(ui->screen_btn_light_on, &lv_font_Alatsi_Regular_26, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->screen_btn_light_on, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN|LV_STATE_DEFAULT);
@@ -146,20 +139,11 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_label_Welcome, 326, 31);
 
 	//Write style for screen_label_Welcome, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_border_width(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_color(ui->screen_label_Welcome, lv_color_hex(0xffffff), LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_label_Welcome, &style_screen_shared_0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_font(ui->screen_label_Welcome, &lv_font_montserratMedium_26, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_letter_space(ui->screen_label_Welcome, 2, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_line_space(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->screen_label_Welcome, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_opa(ui->screen_label_Welcome, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_color(ui->screen_label_Welcome, lv_color_hex(0x262626), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_top(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_right(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_bottom(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_left(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_label_Welcome, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 
 	//Write codes screen_btn_food
 	ui->screen_btn_food = lv_btn_create(ui->screen);
@@ -172,16 +156,14 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_btn_food, 230, 160);
 
 	//Write style for screen_btn_food, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_bg_opa(ui->screen_btn_food, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_color(ui->screen_btn_food, lv_color_hex(0x262626), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_border_width(ui->screen_btn_food, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_btn_food, 5, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_btn_food, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_btn_food, &style_screen_shared_1, LV_PART_MAIN|LV_STATE_DEFAULT);
+	static lv_style_t style_screen_shared_2;
+	ui_init_style(&style_screen_shared_2);
+	lv_style_set_text_color(&style_screen_shared_2, lv_color_hex(0x000000));
+	lv_style_set_text_font(&style_screen_shared_2, &lv_font_Alatsi_Regular_25);
+	lv_style_set_text_align(&style_screen_shared_2, LV_TEXT_ALIGN_LEFT);
+	lv_obj_add_style(ui->screen_btn_food, &style_screen_shared_2, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_img_src(ui->screen_btn_food, &_food_camera_230x160, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_img_opa(ui->screen_btn_food, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_color(ui->screen_btn_food, lv_color_hex(0x000000), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_font(ui->screen_btn_food, &lv_font_Alatsi_Regular_25, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_align(ui->screen_btn_food, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN|LV_STATE_DEFAULT);
 
 	//Write codes screen_btn_standby
 	ui->screen_btn_standby = lv_btn_create(ui->screen);
@@ -194,18 +176,11 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_btn_standby, 230, 160);
 
 	//Write style for screen_btn_standby, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_bg_opa(ui->screen_btn_standby, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_color(ui->screen_btn_standby, lv_color_hex(0x262626), LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_btn_standby, &style_screen_shared_1, LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_btn_standby, &style_screen_shared_2, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_grad_dir(ui->screen_btn_standby, LV_GRAD_DIR_HOR, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_grad_color(ui->screen_btn_standby, lv_color_hex(0x888585), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_border_width(ui->screen_btn_standby, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_btn_standby, 5, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_btn_standby, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_img_src(ui->screen_btn_standby, &_standby_230x160, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_bg_img_opa(ui->screen_btn_standby, 255, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_color(ui->screen_btn_standby, lv_color_hex(0x000000), LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_font(ui->screen_btn_standby, &lv_font_Alatsi_Regular_25, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_align(ui->screen_btn_standby, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN|LV_STATE_DEFAULT);
 
 	//Write codes screen_img_home
 	ui->screen_img_home = lv_img_create(ui->screen);
@@ -229,19 +204,10 @@ void setup_scr_screen(lv_ui *ui)
 	lv_obj_set_size(ui->screen_label_weather, 206, 100);
 
 	//Write style for screen_label_weather, Part: LV_PART_MAIN, State: LV_STATE_DEFAULT.
-	lv_obj_set_style_border_width(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_radius(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_color(ui->screen_label_weather, lv_color_hex(0xffffff), LV_PART_MAIN|LV_STATE_DEFAULT);
+	lv_obj_add_style(ui->screen_label_weather, &style_screen_shared_0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_font(ui->screen_label_weather, &lv_font_montserratMedium_23, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_letter_space(ui->screen_label_weather, 2, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_text_line_space(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_text_align(ui->screen_label_weather, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN|LV_STATE_DEFAULT);
 	lv_obj_set_style_bg_opa(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_top(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_right(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_bottom(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_pad_left(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
-	lv_obj_set_style_shadow_width(ui->screen_label_weather, 0, LV_PART_MAIN|LV_STATE_DEFAULT);
 
 	//Write codes screen_img_light_off
 	ui->screen_img_light_off = lv_img_create(ui->screen);
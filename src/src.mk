@@ -8,5 +8,11 @@
 CSRCS += $(wildcard $(LVGL_DIR)/src/generated/*.c)
 CSRCS += $(wildcard $(LVGL_DIR)/src/generated/guider_customer_fonts/*.c)
 CSRCS += $(wildcard $(LVGL_DIR)/src/generated/guider_fonts/*.c)
+ifeq ($(ASSET_PACK),1)
+# the images are mapped from the bundle of tools/pack_assets.py, see src/custom/asset_pack.h
+CFLAGS += -DASSET_PACK
+CPPFLAGS += -DASSET_PACK
+else
 CSRCS += $(wildcard $(LVGL_DIR)/src/generated/images/*.c)
+endif
 CSRCS += $(wildcard $(LVGL_DIR)/src/custom/*.c)
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// nearest rank percentile: the smallest value with at least p% of the values at or below it, p in [0, 100]
+static inline double percentile(std::vector<double> values, double p)
+{
+    if (values.empty())
+        return 0;
+    std::sort(values.begin(), values.end());
+    size_t rank = (size_t)std::ceil(p / 100.0 * values.size());
+    return values[rank == 0 ? 0 : std::min(rank, values.size()) - 1];
+}
+
+static inline double mean(const std::vector<double> &values)
+{
+    double sum = 0;
+    for (double v : values)
+        sum += v;
+    return values.empty() ? 0 : sum / values.size();
+}
+
+// peak resident set size of this process in kB, VmHWM from /proc
+static inline long vm_hwm_kb(void)
+{
+    char line[128];
+    long kb = -1;
+    FILE *fp = fopen("/proc/self/status", "r");
+    if (!fp)
+        return -1;
+    while (fgets(line, sizeof(line), fp)) {
+        if (strncmp(line, "VmHWM:", 6) == 0) {
+            kb = atol(line + 6);
+            break;
+        }
+    }
+    fclose(fp);
+    return kb;
+}
+
+// {"mean": .., "p50": .., "p95": .., "p99": ..}
+static inline void print_latency_json(FILE *out, const std::vector<double> &values)
+{
+    fprintf(out, "{\"mean\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f}",
+            mean(values), percentile(values, 50), percentile(values, 95), percentile(values, 99));
+}
+
+// a JSON string with its quotes, paths and names can hold any character
+static inline void print_json_string(FILE *out, const std::string &value)
+{
+    fputc('"', out);
+    for (unsigned char c : value) {
+        if (c == '"' || c == '\\')
+            fprintf(out, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(out, "\\u%04x", c);
+        else
+            fputc(c, out);
+    }
+    fputc('"', out);
+}
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+
+"""
+Folds the local styles of the GUI Guider screens into shared styles:
+  fold_styles.py [--dry-run] src/generated/setup_scr_*.c
+
+Guider writes every style property of every widget as a local style
+(lv_obj_set_style_*), each one stored again in the lvgl heap for that
+widget. The property sets that several widgets of a screen have in common
+become one static lv_style_t, written like Guider writes its own shared
+styles (ui_init_style() then lv_style_set_*), and added to the widgets
+with lv_obj_add_style(). What is left stays local. Added styles come after
+the theme ones, so the screens look the same.
+
+Only the calls of the "//Write style for" blocks are folded, and each
+block is rewritten where it is, so the widgets are still created, placed
+and sized before they are styled. Style calls Guider writes with the
+widget itself, like pad_all of a button, stay as they are, and so do the
+properties of that widget they overlap.
+
+Run it again after each Guider export; a folded file is left as it is.
+"""
+
+import argparse
+import collections
+import re
+import sys
+
+STYLE_CALL = re.compile(r"^\s*lv_obj_set_style_(\w+)\((ui->\w+), (.*), ([A-Z_|]+)\);\s*$")
+SHARED_NAME = re.compile(r"\bstyle_(\w+)_shared_(\d+)\b")
+STYLE_BLOCK = re.compile(r"^\s*//Write style for ")
+CODE_BLOCK = re.compile(r"^\s*//Write codes ")
+
+# shorthand properties and the ones they set
+SHORTHAND = {
+    "pad_all": {"pad_top", "pad_bottom", "pad_left", "pad_right"},
+    "pad_hor": {"pad_left", "pad_right"},
+    "pad_ver": {"pad_top", "pad_bottom"},
+    "pad_gap": {"pad_row", "pad_column"},
+}
+
+# a shared style is worth it from that many properties in common
+MIN_PROPS = 3
+
+
+def selector(text):
+    # lv_obj_set_style_pad_all(obj, 0, LV_STATE_DEFAULT) is the main part too
+    parts = set(text.split("|"))
+    if not any(p.startswith("LV_PART_") for p in parts):
+        parts.add("LV_PART_MAIN")
+    part = [p for p in parts if p.startswith("LV_PART_")]
+    state = [p for p in parts if not p.startswith("LV_PART_")]
+    return "|".join(sorted(part) + sorted(state))
+
+
+def parse(lines):
+    """
+    the local properties of each (object, selector) in the style blocks, last
+    one wins, the lines they are on, and per object the properties set
+    outside the style blocks
+    """
+    props = collections.OrderedDict()
+    where = collections.defaultdict(list)
+    pinned = collections.defaultdict(set)
+    in_style = False
+    for n, line in enumerate(lines):
+        if STYLE_BLOCK.match(line):
+            in_style = True
+        elif CODE_BLOCK.match(line):
+            in_style = False
+        m = STYLE_CALL.match(line)
+        if not m:
+            continue
+        if not in_style:
+            pinned[m.group(2)] |= {m.group(1)} | SHORTHAND.get(m.group(1), set())
+            continue
+        key = (m.group(2), selector(m.group(4)))
+        props.setdefault(key, collections.OrderedDict())[m.group(1)] = m.group(3)
+        where[key].append(n)
+    return props, where, pinned
+
+
+def fold(props, pinned):
+    """greedy: the largest common property set of two or more widgets first"""
+    # what a call outside the style blocks also sets is kept local, in its order
+    left = {key: {(prop, v) for prop, v in p.items() if prop not in pinned[key[0]]}
+            for key, p in props.items()}
+    kept = {key: {(prop, v) for prop, v in p.items() if prop in pinned[key[0]]} for key, p in props.items()}
+    shared = []
+    while True:
+        best = None
+        keys = list(left)
+        for i, a in enumerate(keys):
+            for b in keys[i + 1:]:
+                if a[1] != b[1]:
+                    continue
+                common = left[a] & left[b]
+                if len(common) < MIN_PROPS:
+                    continue
+                users = [k for k in keys if k[1] == a[1] and common <= left[k]]
+                gain = (len(users) - 1) * len(common)
+                if not best or gain > best[0]:
+                    best = (gain, common, users)
+        if not best:
+            return shared, {key: left[key] | kept[key] for key in left}
+        _, common, users = best
+        for k in users:
+            left[k] -= common
+        shared.append((common, users))
+
+
+def rewrite(lines, screen, props, where, shared, left):
+    first_free = 0
+    for line in lines:
+        for m in SHARED_NAME.finditer(line):
+            if m.group(1) == screen:
+                first_free = max(first_free, int(m.group(2)) + 1)
+
+    # where each widget's styles go: its first call in its style block
+    added = collections.defaultdict(list)
+    for i, (common, users) in enumerate(shared):
+        name = "style_%s_shared_%d" % (screen, first_free + i)
+        # properties in the order Guider wrote them for the first widget
+        order = [p for p in props[users[0]].items() if p in common]
+        for k in users:
+            added[k].append((name, order, k == users[0]))
+
+    out = {}
+    drop = set()
+    for key, lines_at in where.items():
+        obj, sel = key
+        at = lines_at[0]
+        indent = re.match(r"^\s*", lines[at]).group(0)
+        text = []
+        for name, order, define in added[key]:
+            if define:
+                text.append("%sstatic lv_style_t %s;\n" % (indent, name))
+                text.append("%sui_init_style(&%s);\n" % (indent, name))
+                for prop, value in order:
+                    text.append("%slv_style_set_%s(&%s, %s);\n" % (indent, prop, name, value))
+            text.append("%slv_obj_add_style(%s, &%s, %s);\n" % (indent, obj, name, sel))
+        for prop, value in props[key].items():
+            if (prop, value) in left[key]:
+                text.append("%slv_obj_set_style_%s(%s, %s, %s);\n" % (indent, prop, obj, value, sel))
+        out[at] = text
+        drop.update(lines_at[1:])
+
+    result = []
+    for n, line in enumerate(lines):
+        if n in out:
+            result.extend(out[n])
+        elif n not in drop:
+            result.append(line)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="fold the Guider local styles into shared styles")
+    parser.add_argument("--dry-run", action="store_true", help="only print what would be folded")
+    parser.add_argument("files", nargs="+")
+    args = parser.parse_args()
+
+    for path in args.files:
+        m = re.search(r"setup_scr_(\w+)\.c$", path)
+        if not m:
+            print("%s: not a Guider screen, skipped" % path)
+            continue
+        with open(path) as f:
+            lines = f.readlines()
+
+        props, where, pinned = parse(lines)
+        shared, left = fold(props, pinned)
+        before = sum(len(p) for p in props.values())
+        after = sum(len(p) for p in left.values())
+        local_before = len({k[0] for k in props})
+        local_after = len({k[0] for k, p in left.items() if p})
+        print("%s: %d local properties on %d widgets -> %d on %d widgets, %d shared styles"
+              % (path, before, local_before, after, local_after, len(shared)))
+        for common, users in shared:
+            print("  %d properties for %s" % (len(common), ", ".join(k[0][4:] for k in users)))
+
+        if args.dry_run or not shared:
+            continue
+        with open(path, "w") as f:
+            f.writelines(rewrite(lines, m.group(1), props, where, shared, left))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
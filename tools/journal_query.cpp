@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * What was on the shelf at a given time, from the detection journal:
+ *   journal_query <journal dir> [unix time, now by default] [labels file]
+ * One line per item present: track, label, score, box, since when and its
+ * thumbnail. Works on the live journal of a running lvgl_demo; a time
+ * before its start is looked up in the previous, full journal file.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "ml/detection_journal.h"
+
+static std::string format_time(uint64_t time_us)
+{
+    time_t t = time_us / 1000000;
+    char buf[32];
+    strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", localtime(&t));
+    return buf;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <journal dir> [unix time] [labels file]\n", argv[0]);
+        return 1;
+    }
+
+    uint64_t at_us = argc > 2 ? (uint64_t)atoll(argv[2]) * 1000000 : (uint64_t)time(NULL) * 1000000;
+    std::vector<std::string> labels;
+    if (argc > 3) {
+        std::ifstream file(argv[3]);
+        std::string line;
+        while (std::getline(file, line))
+            labels.push_back(line);
+    }
+
+    // the current file, then the one it replaced
+    std::vector<JournalItem> items;
+    const char *files[] = {JOURNAL_FILE, JOURNAL_PREVIOUS_FILE};
+    std::unique_ptr<DetectionJournal> journal;
+    const char *file = nullptr;
+    for (const char *name : files) {
+        journal.reset(new DetectionJournal(argv[1]));
+        if (journal->open(true, name) && journal->shelf_at(at_us, items)) {
+            file = name;
+            break;
+        }
+    }
+    if (!file) {
+        printf("%s is before the journal\n", format_time(at_us).c_str());
+        return 1;
+    }
+
+    printf("%s: %zu items (%llu events in %s)\n", format_time(at_us).c_str(), items.size(),
+            (unsigned long long)journal->events(), file);
+    for (const JournalItem &item : items) {
+        const char *label = item.label < (int)labels.size() ? labels[item.label].c_str() : "";
+        std::string thumb;
+        struct stat st;
+        if (item.thumb != JOURNAL_NO_THUMB && stat(journal->thumb_path(item.thumb).c_str(), &st) == 0)
+            thumb = journal->thumb_path(item.thumb);
+        printf("  track %-5u %3d %-12s %.2f  %d,%d %dx%d  since %s  %s\n", item.track, item.label, label,
+                item.score, item.box.x, item.box.y, item.box.width, item.box.height,
+                format_time(item.since_us).c_str(), thumb.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,390 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Offline benchmark of YOLOV4::run, without camera, display or GUI:
+ *   ml_bench --model <tflite> [--delegate cpu|vx|ethosu|xnnpack|auto] [--threads N]
+ *            [--images <dir> | --frames <file.yuyv>] [--iterations N] [--warmup N]
+ *            [--output <file.json>] [--profile 1] [--classifier <tflite> [--budget ms]]
+ *            [--g2d 1] [--check 1]
+ * --frames takes raw 640x480 YUYV frames back to back, as recorded with
+ *   v4l2-ctl --set-fmt-video=width=640,height=480,pixelformat=YUYV \
+ *            --stream-mmap --stream-count=100 --stream-to=frames.yuyv
+ * Without input a synthetic frame is used. The JSON report goes to --output,
+ * or alone on stdout: the model's own logs and the profile table go to stderr.
+ * --profile 1 repeats the iterations with the operator profiler attached,
+ * prints its table and reports the profiler overhead on invoke.
+ * --classifier runs the two stage pipeline with --model as the fruit detector,
+ * its total is to be compared with the single model's.
+ * --g2d 1 fills the input like the application does with G2D, from BGRA G2D
+ * buffers; the report counts the CPU copies of each path.
+ * --check 1 runs every frame through the CPU and the G2D path instead, and
+ * fails unless the G2D one made no frame sized copy and fewer input sized ones,
+ * and both found about as many objects in every frame.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ml/ml_config.h"
+#include "ml/yolov4_tflite.h"
+#include "ml/two_stage_detector.h"
+#include "ml/g2d_input.h"
+#include "bench_util.h"
+
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+// detections a frame may differ by between the paths, their scalers do not round alike
+#define CHECK_COUNT_TOLERANCE 1
+
+static void usage(const char *name)
+{
+    printf("usage: %s --model <tflite> [--delegate cpu|vx|ethosu|xnnpack|auto] [--threads N]\n"
+           "       [--images <dir> | --frames <file.yuyv>] [--iterations N] [--warmup N]\n"
+           "       [--output <file.json>] [--profile 1] [--classifier <tflite> [--budget ms]]\n"
+           "       [--g2d 1] [--check 1]\n", name);
+}
+
+static bool load_images(const std::string &dir, std::vector<cv::Mat> &frames)
+{
+    std::vector<std::string> files;
+    cv::glob(dir + "/*", files, false);
+    for (auto &file : files) {
+        cv::Mat bgr = cv::imread(file, cv::IMREAD_COLOR);
+        if (bgr.empty())
+            continue;
+        cv::Mat rgb;
+        cv::cvtColor(bgr, rgb, cv::COLOR_BGR2RGB);
+        frames.push_back(rgb);
+    }
+    return !frames.empty();
+}
+
+static bool load_frames(const std::string &path, std::vector<cv::Mat> &frames)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    std::vector<uint8_t> yuyv(FRAME_WIDTH * FRAME_HEIGHT * 2);
+    while (file.read((char *)yuyv.data(), yuyv.size())) {
+        cv::Mat src(FRAME_HEIGHT, FRAME_WIDTH, CV_8UC2, yuyv.data());
+        cv::Mat rgb;
+        cv::cvtColor(src, rgb, cv::COLOR_YUV2RGB_YUYV);
+        frames.push_back(rgb);
+    }
+    return !frames.empty();
+}
+
+// CPU copies of the two input paths, counted by the model, on every frame
+static bool check_input_paths(YOLOV4 &model, G2DInput &g2d_input, const std::vector<cv::Mat> &frames,
+        const std::vector<struct g2d_buf *> &g2d_frames, FILE *out)
+{
+    StageTimes cpu, g2d;
+    bool passed = true, bound = false;
+    int mismatches = 0;
+    long cpu_detections = 0, g2d_detections = 0;
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        Prediction cpu_pred, g2d_pred;
+        model.run(frames[i], cpu_pred);
+        cpu = model.times;
+        if (!g2d_input.convert(model, g2d_frames[i], frames[i].cols, frames[i].rows)) {
+            printf("G2D conversion failed\n");
+            return false;
+        }
+        model.run_prepared(frames[i].cols, frames[i].rows, g2d_pred, g2d_input.convert_ms());
+        g2d = model.times;
+        bound = g2d_input.bound();
+
+        if (cpu.full_copies < 1 || g2d.full_copies != 0 || g2d.input_copies >= cpu.input_copies ||
+                g2d.input_copies != (bound ? 0 : 1)) {
+            printf("frame %zu: CPU path %d frame and %d input copies, G2D path %d and %d\n", i,
+                    cpu.full_copies, cpu.input_copies, g2d.full_copies, g2d.input_copies);
+            passed = false;
+        }
+        // both paths feed the model the same pixels up to the scaling
+        int cpu_count = cpu_pred.labels.size(), g2d_count = g2d_pred.labels.size();
+        cpu_detections += cpu_count;
+        g2d_detections += g2d_count;
+        if (abs(cpu_count - g2d_count) > CHECK_COUNT_TOLERANCE) {
+            printf("frame %zu: %d detections on the CPU path, %d on the G2D path\n", i, cpu_count, g2d_count);
+            mismatches++;
+            passed = false;
+        }
+    }
+
+    fprintf(out, "{\"check\": \"input_copies\", \"frames\": %zu, "
+            "\"cpu\": {\"full_copies\": %d, \"input_copies\": %d}, "
+            "\"g2d\": {\"full_copies\": %d, \"input_copies\": %d, \"bound\": %s}, "
+            "\"detections\": {\"cpu\": %ld, \"g2d\": %ld}, \"detection_count_mismatches\": %d, "
+            "\"passed\": %s}\n",
+            frames.size(), cpu.full_copies, cpu.input_copies, g2d.full_copies, g2d.input_copies,
+            bound ? "true" : "false", cpu_detections, g2d_detections, mismatches, passed ? "true" : "false");
+    return passed;
+}
+
+int main(int argc, char **argv)
+{
+    std::string model_path, images, frames_path, output, classifier_path;
+    double budget_ms = 0;
+    int delegate = ML_DELEGATE_AUTO;
+    int threads = 2;
+    int iterations = 100;
+    int warmup = 5;
+    bool profile = false;
+    bool use_g2d = false;
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--model") {
+            model_path = value;
+        } else if (arg == "--delegate") {
+            delegate = ml_delegate_from_string(value);
+        } else if (arg == "--threads") {
+            threads = atoi(value.c_str());
+        } else if (arg == "--images") {
+            images = value;
+        } else if (arg == "--frames") {
+            frames_path = value;
+        } else if (arg == "--iterations") {
+            iterations = atoi(value.c_str());
+        } else if (arg == "--warmup") {
+            warmup = atoi(value.c_str());
+        } else if (arg == "--output") {
+            output = value;
+        } else if (arg == "--profile") {
+            profile = atoi(value.c_str()) != 0;
+        } else if (arg == "--classifier") {
+            classifier_path = value;
+        } else if (arg == "--budget") {
+            budget_ms = atof(value.c_str());
+        } else if (arg == "--g2d") {
+            use_g2d = atoi(value.c_str()) != 0;
+        } else if (arg == "--check") {
+            check = atoi(value.c_str()) != 0;
+            use_g2d = use_g2d || check;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (model_path.empty() || delegate < 0 || iterations <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // the model and the delegates log with printf, stdout is kept for the report alone
+    fflush(stdout);
+    FILE *json = fdopen(dup(STDOUT_FILENO), "w");
+    if (!json || dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+        fprintf(stderr, "cannot redirect stdout\n");
+        return 1;
+    }
+
+    std::vector<cv::Mat> frames;
+    std::string source = "synthetic";
+    if (!images.empty()) {
+        if (!load_images(images, frames)) {
+            printf("no readable image in %s\n", images.c_str());
+            return 1;
+        }
+        source = images;
+    } else if (!frames_path.empty()) {
+        if (!load_frames(frames_path, frames)) {
+            printf("no complete %dx%d YUYV frame in %s\n", FRAME_WIDTH, FRAME_HEIGHT, frames_path.c_str());
+            return 1;
+        }
+        source = frames_path;
+    } else {
+        frames.push_back(cv::Mat(FRAME_HEIGHT, FRAME_WIDTH, CV_8UC3, cv::Scalar(96, 128, 64)));
+    }
+
+    long rss_before_kb = vm_hwm_kb();
+    YOLOV4 model(model_path, delegate, threads);
+    std::unique_ptr<TwoStageDetector> two_stage;
+    if (!classifier_path.empty())
+        two_stage.reset(new TwoStageDetector(classifier_path, model.delegate(), threads, budget_ms));
+    long rss_model_kb = vm_hwm_kb();
+
+    // the frames in G2D buffers, BGRA like the camera's
+    G2DInput g2d_input;
+    std::vector<struct g2d_buf *> g2d_frames;
+    if (use_g2d) {
+        if (two_stage || !g2d_input.open()) {
+            printf("--g2d needs G2D and no --classifier\n");
+            return 1;
+        }
+        for (const cv::Mat &frame : frames) {
+            // cacheable, written by the CPU once and flushed for G2D
+            struct g2d_buf *buf = g2d_alloc(frame.cols * frame.rows * 4, 1);
+            if (!buf) {
+                printf("g2d_alloc fail\n");
+                return 1;
+            }
+            cv::Mat bgra(frame.rows, frame.cols, CV_8UC4, buf->buf_vaddr);
+            cv::cvtColor(frame, bgra, cv::COLOR_RGB2BGRA);
+            g2d_cache_op(buf, G2D_CACHE_FLUSH);
+            g2d_frames.push_back(buf);
+        }
+    }
+
+    auto run = [&](size_t index, Prediction &pred) {
+        const cv::Mat &frame = frames[index];
+        if (two_stage) {
+            two_stage->run(model, frame, pred);
+        } else if (use_g2d) {
+            if (!g2d_input.convert(model, g2d_frames[index], frame.cols, frame.rows)) {
+                printf("G2D conversion failed\n");
+                exit(1);
+            }
+            model.run_prepared(frame.cols, frame.rows, pred, g2d_input.convert_ms());
+        } else {
+            model.run(frame, pred);
+        }
+    };
+
+    for (int i = 0; i < warmup; i++) {
+        Prediction pred;
+        run(i % frames.size(), pred);
+    }
+
+    if (check) {
+        bool passed = check_input_paths(model, g2d_input, frames, g2d_frames, json);
+        fclose(json);
+        for (struct g2d_buf *buf : g2d_frames)
+            g2d_free(buf);
+        return passed ? 0 : 1;
+    }
+
+    std::vector<double> preprocess, invoke, decode, nms, total, track, classify;
+    long crops = 0, deferred = 0;
+    std::vector<long> label_counts;
+    long detections = 0, frames_with_detections = 0, empty_exits = 0;
+
+    for (int i = 0; i < iterations; i++) {
+        Prediction pred;
+        run(i % frames.size(), pred);
+
+        const StageTimes &t = model.times;
+        preprocess.push_back(t.preprocess_ms);
+        invoke.push_back(t.invoke_ms);
+        decode.push_back(t.decode_ms);
+        nms.push_back(t.nms_ms);
+        if (t.empty)
+            empty_exits++;
+        if (two_stage) {
+            const TwoStageTimes &ts = two_stage->times;
+            track.push_back(ts.track_ms);
+            classify.push_back(ts.classify_ms);
+            total.push_back(ts.detect_ms + ts.track_ms + ts.classify_ms);
+            crops += ts.crops;
+            deferred += ts.deferred;
+        } else {
+            total.push_back(t.preprocess_ms + t.invoke_ms + t.decode_ms + t.nms_ms);
+        }
+
+        detections += pred.labels.size();
+        if (!pred.labels.empty())
+            frames_with_detections++;
+        for (int label : pred.labels) {
+            if (label >= (int)label_counts.size())
+                label_counts.resize(label + 1, 0);
+            label_counts[label]++;
+        }
+    }
+
+    // same frames again with the profiler, the difference is its overhead
+    std::vector<double> invoke_profiled, total_profiled;
+    if (profile) {
+        model.set_profiling(true);
+        for (int i = 0; i < iterations; i++) {
+            Prediction pred;
+            run(i % frames.size(), pred);
+            const StageTimes &t = model.times;
+            invoke_profiled.push_back(t.invoke_ms);
+            if (two_stage) {
+                const TwoStageTimes &ts = two_stage->times;
+                total_profiled.push_back(ts.detect_ms + ts.track_ms + ts.classify_ms);
+            } else {
+                total_profiled.push_back(t.preprocess_ms + t.invoke_ms + t.decode_ms + t.nms_ms);
+            }
+        }
+        fprintf(stderr, "%s", model.profile_summary().c_str());
+        model.set_profiling(false);
+    }
+
+    FILE *out = json;
+    if (!output.empty()) {
+        out = fopen(output.c_str(), "w");
+        if (!out) {
+            printf("cannot write %s\n", output.c_str());
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"model\": "); print_json_string(out, model_path); fprintf(out, ",\n");
+    fprintf(out, "  \"delegate\": \"%s\",\n", ml_delegate_name(model.delegate()));
+    fprintf(out, "  \"threads\": %d,\n", threads);
+    fprintf(out, "  \"source\": "); print_json_string(out, source); fprintf(out, ",\n");
+    fprintf(out, "  \"input_frames\": %zu,\n", frames.size());
+    fprintf(out, "  \"iterations\": %d,\n", iterations);
+    // frame and input tensor sized CPU copies per inference, the same for every frame
+    fprintf(out, "  \"input\": {\"g2d\": %s, \"full_copies\": %d, \"input_copies\": %d},\n",
+            use_g2d ? "true" : "false", model.times.full_copies, model.times.input_copies);
+    if (two_stage) {
+        fprintf(out, "  \"two_stage\": {\"classifier\": "); print_json_string(out, classifier_path);
+        fprintf(out, ", \"budget_ms\": %.1f, \"crops\": %ld, \"deferred\": %ld},\n", budget_ms, crops, deferred);
+    }
+    fprintf(out, "  \"stages_ms\": {\n");
+    fprintf(out, "    \"preprocess\": "); print_latency_json(out, preprocess); fprintf(out, ",\n");
+    fprintf(out, "    \"invoke\": "); print_latency_json(out, invoke); fprintf(out, ",\n");
+    fprintf(out, "    \"decode\": "); print_latency_json(out, decode); fprintf(out, ",\n");
+    fprintf(out, "    \"nms\": "); print_latency_json(out, nms); fprintf(out, ",\n");
+    if (two_stage) {
+        fprintf(out, "    \"track\": "); print_latency_json(out, track); fprintf(out, ",\n");
+        fprintf(out, "    \"classify\": "); print_latency_json(out, classify); fprintf(out, ",\n");
+    }
+    fprintf(out, "    \"total\": "); print_latency_json(out, total); fprintf(out, "\n");
+    fprintf(out, "  },\n");
+    fprintf(out, "  \"memory_kb\": {\"hwm_before_model\": %ld, \"hwm_after_model\": %ld, \"hwm\": %ld},\n",
+            rss_before_kb, rss_model_kb, vm_hwm_kb());
+    fprintf(out, "  \"detections\": {\"total\": %ld, \"frames_with_detections\": %ld, \"empty_exits\": %ld, "
+            "\"per_label\": [", detections, frames_with_detections, empty_exits);
+    for (size_t i = 0; i < label_counts.size(); i++)
+        fprintf(out, "%s%ld", i ? ", " : "", label_counts[i]);
+    fprintf(out, "]}%s\n", profile ? "," : "");
+    if (profile) {
+        // invoke covers the per op events, total also the collection after each invoke
+        double off = percentile(invoke, 50), on = percentile(invoke_profiled, 50);
+        double total_off = percentile(total, 50), total_on = percentile(total_profiled, 50);
+        fprintf(out, "  \"profiler_overhead\": {\"invoke_p50_ms\": [%.3f, %.3f], \"total_p50_ms\": [%.3f, %.3f], "
+                "\"invoke_percent\": %.2f, \"total_percent\": %.2f}\n", off, on, total_off, total_on,
+                off > 0 ? 100.0 * (on - off) / off : 0.0,
+                total_off > 0 ? 100.0 * (total_on - total_off) / total_off : 0.0);
+    }
+    fprintf(out, "}\n");
+
+    if (out != json)
+        fclose(out);
+    fclose(json);
+    for (struct g2d_buf *buf : g2d_frames)
+        g2d_free(buf);
+    return 0;
+}
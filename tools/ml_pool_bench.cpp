@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Throughput and latency of the inference pool against its worker count:
+ *   ml_pool_bench <model> [max_workers] [frames] [delegate] [threads] [image]
+ * Frames are submitted as fast as the workers accept them, one JSON line per
+ * worker count is printed on stdout.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "ml/ml_config.h"
+#include "ml/inference_pool.h"
+#include "bench_util.h"
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <model> [max_workers] [frames] [delegate] [threads] [image]\n", argv[0]);
+        return 1;
+    }
+
+    std::string model_path = argv[1];
+    int max_workers = argc > 2 ? atoi(argv[2]) : 2;
+    int frames = argc > 3 ? atoi(argv[3]) : 100;
+    int delegate = argc > 4 ? ml_delegate_from_string(argv[4]) : ML_DELEGATE_XNNPACK;
+    int threads = argc > 5 ? atoi(argv[5]) : 1;
+    if (delegate < 0) {
+        printf("unknown delegate %s\n", argv[4]);
+        return 1;
+    }
+    if (max_workers < 1 || frames < 1) {
+        printf("max_workers and frames must be at least 1\n");
+        return 1;
+    }
+
+    cv::Mat frame;
+    if (argc > 6) {
+        cv::Mat bgr = cv::imread(argv[6]);
+        if (bgr.empty()) {
+            printf("cannot read %s\n", argv[6]);
+            return 1;
+        }
+        cv::cvtColor(bgr, frame, cv::COLOR_BGR2RGB);
+    } else {
+        frame = cv::Mat(480, 640, CV_8UC3, cv::Scalar(96, 128, 64));
+    }
+
+    for (int workers = 1; workers <= max_workers; workers++) {
+        ModelReloader models(model_path, delegate, threads, workers);
+        std::vector<double> latencies;
+        std::atomic<int> done(0);
+
+        InferencePool pool(models, [&](InferenceResult &res) {
+            latencies.push_back(res.latency_ms);
+            done++;
+        });
+        pool.start();
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; ) {
+            if (pool.submit(frame, i))
+                i++;
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        while (done < frames)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        pool.stop();
+
+        if (latencies.empty()) {
+            printf("{\"workers\": %d, \"error\": \"no results\"}\n", workers);
+            continue;
+        }
+        printf("{\"workers\": %d, \"delegate\": \"%s\", \"threads\": %d, \"frames\": %d, "
+               "\"fps\": %.2f, \"latency_ms\": {\"mean\": %.2f, \"p50\": %.2f, \"p95\": %.2f}}\n",
+               workers, ml_delegate_name(delegate), threads, frames, frames / elapsed_s,
+               mean(latencies), percentile(latencies, 50), percentile(latencies, 95));
+        fflush(stdout);
+    }
+    return 0;
+}
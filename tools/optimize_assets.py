@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+
+"""
+Takes the alpha channel out of the GUI Guider images that do not need it:
+  optimize_assets.py [--dry-run] [--background <image>=0xRRGGBB ...] images/*.c
+
+Guider exports every image as LV_IMG_CF_TRUE_COLOR_ALPHA, so lvgl blends
+each of its pixels on every redraw. An image whose pixels are all opaque
+is rewritten as LV_IMG_CF_TRUE_COLOR, which lvgl copies. An image given a
+--background, the color it is always drawn on, is first composed onto it
+and then rewritten the same way. The pixels of every color depth are
+converted; at 8 and 16 bit the alpha byte is dropped as well.
+
+Only give a background to an image that never moves over anything else:
+the composed edges would show the old color. The screens next to the
+images directory are read to refuse it for an image that is recolored,
+since then only the alpha gives it its shape, and for one drawn on a
+background that changes with the state, like that of a pressed button.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+from pack_assets import parse_image
+
+# bytes per pixel of TRUE_COLOR_ALPHA and where the alpha byte is, by depth
+ALPHA_PX = {"8": 2, "16": 3, "16swap": 3, "32": 4}
+
+FORMAT = {
+    "8": "Red: 3 bit, Green: 3 bit, Blue: 2 bit",
+    "16": "Red: 5 bit, Green: 6 bit, Blue: 5 bit",
+    "16swap": "Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped",
+    "32": "Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit",
+}
+
+CONDITION = {
+    "8": "LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8",
+    "16": "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0",
+    "16swap": "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0",
+    "32": "LV_COLOR_DEPTH == 32",
+}
+
+CREATE = re.compile(r"ui->(\w+) = (\w+)_create\((?:ui->(\w+)|NULL)\);")
+IMG_SRC = re.compile(r"(lv_img_set_src|lv_obj_set_style_bg_img_src)\(ui->(\w+), &(\w+)")
+RECOLOR = re.compile(r"lv_obj_set_style_(img|bg_img)_recolor_opa\(ui->(\w+), (\d+),")
+STYLE_RECOLOR = re.compile(r"lv_style_set_(img|bg_img)_recolor_opa\(&(\w+), (\d+)\);")
+ADD_STYLE = re.compile(r"lv_obj_add_style\(ui->(\w+), &(\w+),")
+STATE_STYLE = re.compile(r"lv_obj_set_style_\w+\(ui->(\w+), .*LV_STATE_(?!DEFAULT)\w+\);")
+
+# the theme restyles these when pressed, checked or focused
+STATEFUL = {"lv_btn", "lv_imgbtn", "lv_checkbox", "lv_switch"}
+
+
+def screen_users(images_dir):
+    """for each image of the screens, why it must keep its alpha, or None"""
+    widgets = {}
+    users = {}
+    recolored = set()
+    styles = {}
+    stateful = set()
+    for path in sorted(glob.glob(os.path.join(os.path.dirname(images_dir), "setup_scr_*.c"))):
+        with open(path) as f:
+            text = f.read()
+        for obj, kind, parent in CREATE.findall(text):
+            widgets[obj] = (kind, parent)
+            if kind in STATEFUL:
+                stateful.add(obj)
+        for call, obj, name in IMG_SRC.findall(text):
+            users.setdefault(name, []).append((obj, "img" if call == "lv_img_set_src" else "bg_img"))
+        for part, obj, opa in RECOLOR.findall(text):
+            if int(opa):
+                recolored.add((obj, part))
+        for part, style, opa in STYLE_RECOLOR.findall(text):
+            if int(opa):
+                styles.setdefault(style, set()).add(part)
+        for obj, style in ADD_STYLE.findall(text):
+            for part in styles.get(style, ()):
+                recolored.add((obj, part))
+        stateful.update(STATE_STYLE.findall(text))
+
+    reasons = {}
+    for name, objs in users.items():
+        for obj, part in objs:
+            # an image is drawn on its parent, a background image on its own object
+            below = obj if part == "bg_img" else widgets.get(obj, (None, None))[1]
+            if (obj, part) in recolored:
+                reasons[name] = "recolored by %s, its alpha is its shape" % obj
+            elif below in stateful:
+                reasons[name] = "drawn on %s, whose background changes with its state" % below
+    return reasons
+
+
+def mix(fg, bg, a):
+    return (fg * a + bg * (255 - a) + 127) // 255
+
+
+def compose_px(depth, px, bg):
+    """one TRUE_COLOR_ALPHA pixel composed onto bg (r, g, b), without its alpha"""
+    r, g, b = bg
+    a = px[-1]
+    if depth == "32":
+        return bytes((mix(px[0], b, a), mix(px[1], g, a), mix(px[2], r, a), 0xff))
+    if depth == "8":
+        v = px[0]
+        out = mix(v >> 5, r >> 5, a) << 5 | mix(v >> 2 & 7, g >> 5, a) << 2 | mix(v & 3, b >> 6, a)
+        return bytes((out,))
+    v = px[0] | px[1] << 8 if depth == "16" else px[1] | px[0] << 8
+    out = mix(v >> 11, r >> 3, a) << 11 | mix(v >> 5 & 63, g >> 2, a) << 5 | mix(v & 31, b >> 3, a)
+    return bytes((out & 0xff, out >> 8)) if depth == "16" else bytes((out >> 8, out & 0xff))
+
+
+def convert(img, bg):
+    """the TRUE_COLOR pixels of every depth, None when an alpha is needed"""
+    out = {}
+    for depth, data in img.sections.items():
+        size = ALPHA_PX[depth]
+        if bg is None and any(a != 0xff for a in data[size - 1::size]):
+            return None
+        pixels = bytearray()
+        for i in range(0, len(data), size):
+            px = data[i:i + size]
+            if bg is not None:
+                pixels += compose_px(depth, px, bg)
+            elif depth == "32":
+                pixels += px
+            else:
+                pixels += px[:-1]
+        out[depth] = pixels
+    return out
+
+
+def rewrite(path, img, sections):
+    with open(path) as f:
+        text = f.read()
+
+    lines = []
+    for depth in ("8", "16", "16swap", "32"):
+        if depth not in sections:
+            continue
+        row = len(sections[depth]) // img.h
+        lines.append("#if %s\n" % CONDITION[depth])
+        lines.append("  /*Pixel format: %s*/\n" % FORMAT[depth])
+        data = sections[depth]
+        for y in range(img.h):
+            lines.append("  " + "".join("0x%02x, " % b for b in data[y * row:(y + 1) * row]) + "\n")
+        lines.append("#endif\n")
+
+    start = re.search(r"uint8_t %s_map\[\] = \{\n" % re.escape(img.name), text)
+    end = text.index("};", start.end())
+    text = text[:start.end()] + "".join(lines) + text[end:]
+    text = text.replace(".header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,", ".header.cf = LV_IMG_CF_TRUE_COLOR,")
+    text = re.sub(r"\.data_size = (\d+) \* LV_IMG_PX_SIZE_ALPHA_BYTE,", r".data_size = \1 * LV_COLOR_SIZE / 8,", text)
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="drop the alpha channel of the Guider images that do not need it")
+    parser.add_argument("--dry-run", action="store_true", help="only print what would be converted")
+    parser.add_argument("--background", action="append", default=[], metavar="IMAGE=0xRRGGBB",
+                        help="compose an image onto the color it is always drawn on")
+    parser.add_argument("images", nargs="+")
+    args = parser.parse_args()
+
+    backgrounds = {}
+    for spec in args.background:
+        name, _, color = spec.partition("=")
+        try:
+            value = int(color, 16)
+        except ValueError:
+            print("bad --background %s" % spec)
+            return 1
+        backgrounds[name] = (value >> 16 & 0xff, value >> 8 & 0xff, value & 0xff)
+
+    reasons = {}
+    for images_dir in sorted({os.path.dirname(os.path.abspath(path)) for path in args.images}):
+        reasons.update(screen_users(images_dir))
+
+    saved = 0
+    for path in sorted(args.images):
+        img = parse_image(path)
+        if not img or img.cf != "LV_IMG_CF_TRUE_COLOR_ALPHA":
+            continue
+        bg = backgrounds.pop(img.name, None)
+        if bg is not None and img.name in reasons:
+            print("%s: no --background, %s" % (img.name, reasons[img.name]))
+            bg = None
+        sections = convert(img, bg)
+        if sections is None:
+            print("%s: keeps its alpha" % img.name)
+            continue
+
+        how = "composed onto 0x%02x%02x%02x" % bg if bg else "opaque"
+        print("%s: %s, %d px no longer blended per draw" % (img.name, how, img.w * img.h))
+        saved += img.w * img.h
+        if not args.dry_run:
+            rewrite(path, img, sections)
+
+    for name in backgrounds:
+        print("%s: no such image with alpha" % name)
+    print("%d px per full redraw of all of them copied instead of blended" % saved)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 NXP
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+
+"""
+Packs the GUI Guider images into one bundle mapped at run time:
+  pack_assets.py [--depth 32|16|16swap] [--align N] [--refs asset_refs.c] --output assets.bin images/*.c
+
+The pixels of each image/*.c for the given color depth are written page
+aligned after a table of entries, so every image is paged in on its first
+draw only and the bundle can be replaced without relinking. --refs writes
+the descriptors the screens link against in builds with ASSET_PACK=1: they
+only name their entry, src/custom/asset_pack.c resolves them.
+
+Layout, little endian, see asset_pack.h:
+  header  "LVAP", version, color depth, entry count     16 bytes
+  entry   name[40], cf, w, h, offset, size, reserved   64 bytes each
+  pixels  each at a multiple of --align
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"LVAP"
+VERSION = 1
+NAME_LEN = 40
+HEADER = struct.Struct("<4sIII")
+ENTRY = struct.Struct("<%dsIIIIII" % NAME_LEN)
+
+# lv_img_cf_t of lvgl v8.3
+CF = {
+    "LV_IMG_CF_TRUE_COLOR": 4,
+    "LV_IMG_CF_TRUE_COLOR_ALPHA": 5,
+    "LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED": 6,
+    "LV_IMG_CF_INDEXED_1BIT": 7,
+    "LV_IMG_CF_INDEXED_2BIT": 8,
+    "LV_IMG_CF_INDEXED_4BIT": 9,
+    "LV_IMG_CF_INDEXED_8BIT": 10,
+    "LV_IMG_CF_ALPHA_1BIT": 11,
+    "LV_IMG_CF_ALPHA_2BIT": 12,
+    "LV_IMG_CF_ALPHA_4BIT": 13,
+    "LV_IMG_CF_ALPHA_8BIT": 14,
+}
+
+# the pixel sections Guider writes, by the condition in front of them
+DEPTHS = {
+    "LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8": "8",
+    "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0": "16",
+    "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0": "16swap",
+    "LV_COLOR_DEPTH == 32": "32",
+}
+
+# the header of the sources in src/custom
+LICENSE_HEADER = """\
+/*
+* Copyright 2024 NXP
+* NXP Proprietary. This software is owned or controlled by NXP and may only be used strictly in
+* accordance with the applicable license terms. By expressly accepting such terms or by downloading, installing,
+* activating and/or otherwise using the software, you are agreeing that you have read, and that you agree to
+* comply with and are bound by, such license terms.  If you do not agree to be bound by the applicable license
+* terms, then you may not retain, install, activate or otherwise use the software.
+*/
+"""
+
+HEX = re.compile(r"0x([0-9a-fA-F]{2})")
+
+
+class Image:
+    def __init__(self, name, cf, w, h, sections):
+        self.name = name            # C symbol of the lv_img_dsc_t
+        self.cf = cf                # LV_IMG_CF_* name
+        self.w = w
+        self.h = h
+        self.sections = sections    # depth -> pixel bytes
+
+
+def parse_image(path):
+    """an image .c of GUI Guider, None when it has no image"""
+    with open(path) as f:
+        text = f.read()
+    dsc = re.search(r"const lv_img_dsc_t (\w+) = \{(.*?)\};", text, re.S)
+    if not dsc:
+        return None
+    body = dsc.group(2)
+    cf = re.search(r"\.header\.cf = (\w+)", body).group(1)
+    w = int(re.search(r"\.header\.w = (\d+)", body).group(1))
+    h = int(re.search(r"\.header\.h = (\d+)", body).group(1))
+
+    sections = {}
+    depth = None
+    for line in text[:dsc.start()].splitlines():
+        line = line.strip()
+        if line.startswith("#if "):
+            depth = DEPTHS.get(line[4:])
+        elif line.startswith("#endif"):
+            depth = None
+        elif depth and not line.startswith("/*"):
+            sections.setdefault(depth, bytearray()).extend(int(b, 16) for b in HEX.findall(line))
+    return Image(dsc.group(1), cf, w, h, sections)
+
+
+def align_up(value, align):
+    return (value + align - 1) // align * align
+
+
+def write_bundle(path, images, depth, align):
+    table_end = HEADER.size + ENTRY.size * len(images)
+    offset = align_up(table_end, align)
+    entries, blobs = [], []
+    for img in images:
+        data = bytes(img.sections[depth])
+        entries.append(ENTRY.pack(img.name.encode(), CF[img.cf], img.w, img.h, offset, len(data), 0))
+        blobs.append((offset, data))
+        offset = align_up(offset + len(data), align)
+
+    with open(path + ".tmp", "wb") as f:
+        f.write(HEADER.pack(MAGIC, VERSION, 16 if depth.startswith("16") else int(depth), len(images)))
+        for entry in entries:
+            f.write(entry)
+        for at, data in blobs:
+            f.write(b"\0" * (at - f.tell()))
+            f.write(data)
+    # a running demo keeps the old file mapped
+    os.replace(path + ".tmp", path)
+    return offset
+
+
+def write_refs(path, images):
+    with open(path, "w") as f:
+        f.write(LICENSE_HEADER + "\n")
+        f.write("/* generated by tools/pack_assets.py from src/generated/images, do not edit */\n\n")
+        f.write("#include \"asset_pack.h\"\n\n#ifdef ASSET_PACK\n")
+        for img in images:
+            f.write("const lv_img_dsc_t %s = ASSET_PACK_IMG(\"%s\", %d, %d);\n" % (img.name, img.name, img.w, img.h))
+        f.write("#endif /* ASSET_PACK */\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="pack the Guider images into a mapped bundle")
+    parser.add_argument("--output", required=True, help="bundle to write")
+    parser.add_argument("--depth", default="32", choices=["32", "16", "16swap", "8"],
+                        help="LV_COLOR_DEPTH (and LV_COLOR_16_SWAP) of lv_conf.h")
+    parser.add_argument("--align", type=int, default=4096, help="alignment of the pixels of each image")
+    parser.add_argument("--refs", help="also write the descriptors for ASSET_PACK builds")
+    parser.add_argument("images", nargs="+")
+    args = parser.parse_args()
+
+    if args.align <= 0 or args.align & (args.align - 1):
+        print("--align must be a power of two")
+        return 1
+
+    images = []
+    for path in sorted(args.images):
+        img = parse_image(path)
+        if not img:
+            print("%s: no image, skipped" % path)
+            continue
+        if img.cf not in CF or args.depth not in img.sections:
+            print("%s: %s at depth %s cannot be packed" % (path, img.cf, args.depth))
+            return 1
+        if len(img.name) >= NAME_LEN:
+            print("%s: name longer than %d" % (path, NAME_LEN - 1))
+            return 1
+        images.append(img)
+
+    size = write_bundle(args.output, images, args.depth, args.align)
+    pixels = sum(len(img.sections[args.depth]) for img in images)
+    print("%s: %d images, %d KB of pixels, %d KB with the table and padding"
+          % (args.output, len(images), pixels // 1024, size // 1024))
+    if args.refs:
+        write_refs(args.refs, images)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,326 @@
+/*
+ * Copyright 2024 NXP
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Headless rendering benchmark of the GUI Guider screens, on any Linux host:
+ *   ui_bench [--frames N] [--warmup N] [--scenario <name>] [--assets <bundle>] [--output <file.json>]
+ * The real guider_ui is built on an 800x480 memory display, double buffered
+ * in direct mode like the DRM backend, and every frame is rendered right
+ * away with lv_refr_now(). Scenarios:
+ *   idle_home      home screen, nothing changes
+ *   time_label     the clock label changes every frame
+ *   light_toggle   the light button image, as events_ui_sync() does
+ *   screen_switch  home and camera screens loaded in turn
+ *   camera         camera screen with synthetic frames and moving boxes
+ *   camera_open    camera screen deleted, built again and loaded, like
+ *                  going home and back with CAMERA_SCREEN_DEL_ON_EXIT
+ * The JSON report has per scenario the time of the changes of a frame and
+ * of its render in ms, the flushed pixels per frame, the image pixels
+ * blended and copied per frame and the lvgl heap after it; the same image
+ * and style work on the board shows up here first.
+ * Builds with ASSET_PACK=1 take their images from --assets.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "lvgl/lvgl.h"
+#include "gui_guider.h"
+#include "events_init.h"
+#include "src/custom/custom.h"
+#include "bench_util.h"
+
+#define DISP_HOR_RES 800
+#define DISP_VER_RES 480
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+
+/* what events_init.c expects from the application */
+extern "C" {
+bool g_ui_camera = false;
+bool light_ctl_flag = true;
+FILE *matter_handle = NULL;
+}
+
+lv_ui guider_ui;
+
+static uint64_t flushed_px;
+/* image pixels drawn with alpha blending, and copied as they are */
+static uint64_t img_blend_px, img_copy_px;
+
+static void usage(const char *name)
+{
+    printf("usage: %s [--frames N] [--warmup N] [--scenario <name>] [--assets <bundle>] [--output <file.json>]\n", name);
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/* nothing to send anywhere, only the area is counted */
+static void mem_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    flushed_px += (uint64_t)lv_area_get_width(area) * lv_area_get_height(area);
+    lv_disp_flush_ready(drv);
+}
+
+static void (*sw_draw_img_decoded)(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                                   const lv_area_t *coords, const uint8_t *map_p, lv_img_cf_t cf);
+
+static void count_img_decoded(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *dsc,
+                              const lv_area_t *coords, const uint8_t *map_p, lv_img_cf_t cf)
+{
+    lv_area_t drawn;
+    if (_lv_area_intersect(&drawn, coords, draw_ctx->clip_area)) {
+        bool blend = lv_img_cf_has_alpha(cf) || lv_img_cf_is_chroma_keyed(cf) || dsc->opa < LV_OPA_MAX;
+        (blend ? img_blend_px : img_copy_px) += lv_area_get_size(&drawn);
+    }
+    sw_draw_img_decoded(draw_ctx, dsc, coords, map_p, cf);
+}
+
+/* the software renderer, with the image pixels counted by format */
+static void bench_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+    sw_draw_img_decoded = draw_ctx->draw_img_decoded;
+    draw_ctx->draw_img_decoded = count_img_decoded;
+}
+
+struct Scenario
+{
+    const char *name;
+    void (*setup)(void);
+    void (*prepare)(int i);     /* before a frame, not timed */
+    void (*frame)(int i);
+};
+
+static std::vector<uint8_t> cam_frames[2];
+
+static void setup_home(void)
+{
+    lv_scr_load(guider_ui.screen);
+}
+
+static void frame_idle(int i)
+{
+}
+
+static void frame_time_label(int i)
+{
+    char text[8];
+    snprintf(text, sizeof(text), "%02d:%02d", (i / 60) % 24, i % 60);
+    lv_label_set_text(guider_ui.screen_label_Time, text);
+}
+
+static void frame_light_toggle(int i)
+{
+    events_ui_sync(i & 1);
+}
+
+/* the camera screen is only built on the way to it */
+static void camera_build(void)
+{
+    if (guider_ui.camera_del)
+        setup_scr_camera(&guider_ui);
+}
+
+static void setup_screen_switch(void)
+{
+    camera_build();
+    lv_scr_load(guider_ui.screen);
+}
+
+static void frame_screen_switch(int i)
+{
+    lv_scr_load(i & 1 ? guider_ui.camera : guider_ui.screen);
+}
+
+static void prepare_camera_open(int i)
+{
+    lv_scr_load(guider_ui.screen);
+    if (!guider_ui.camera_del)
+        lv_obj_del(guider_ui.camera);
+}
+
+static void frame_camera_open(int i)
+{
+    camera_build();
+    lv_scr_load(guider_ui.camera);
+}
+
+static void setup_camera(void)
+{
+    for (int f = 0; f < 2; f++) {
+        cam_frames[f].resize(FRAME_WIDTH * FRAME_HEIGHT * 4);
+        for (size_t p = 0; p < cam_frames[f].size(); p += 4) {
+            size_t x = (p / 4) % FRAME_WIDTH, y = (p / 4) / FRAME_WIDTH;
+            cam_frames[f][p] = x + f * 64;
+            cam_frames[f][p + 1] = y;
+            cam_frames[f][p + 2] = (x ^ y) + f * 32;
+            cam_frames[f][p + 3] = 0xff;
+        }
+    }
+    camera_build();
+    lv_scr_load(guider_ui.camera);
+}
+
+static void frame_camera(int i)
+{
+    static const char *labels[3] = {"fresh apple 0.91", "fresh banana 0.84", "rotten orange 0.77"};
+    box_overlay_item_t items[3];
+
+    video_view_submit_frame(guider_ui.camera_video, cam_frames[i & 1].data(), FRAME_WIDTH, FRAME_HEIGHT);
+    video_view_refresh(guider_ui.camera_video);
+
+    memset(items, 0, sizeof(items));
+    for (int b = 0; b < 3; b++) {
+        items[b].x = 40 + b * 180 + (i * 3) % 40;
+        items[b].y = 60 + b * 90 + (i * 2) % 30;
+        items[b].w = 140;
+        items[b].h = 120;
+        items[b].color = lv_palette_main(b == 2 ? LV_PALETTE_BLUE : LV_PALETTE_GREEN);
+        items[b].text = labels[b];
+    }
+    box_overlay_set_boxes(guider_ui.camera_box_overlay, items, 3);
+}
+
+static const Scenario scenarios[] = {
+    {"idle_home", setup_home, NULL, frame_idle},
+    {"time_label", setup_home, NULL, frame_time_label},
+    {"light_toggle", setup_home, NULL, frame_light_toggle},
+    {"screen_switch", setup_screen_switch, NULL, frame_screen_switch},
+    {"camera", setup_camera, NULL, frame_camera},
+    {"camera_open", setup_home, prepare_camera_open, frame_camera_open},
+};
+
+static void print_mem_json(FILE *out)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    fprintf(out, "{\"used_kb\": %u, \"max_used_kb\": %u, \"frag_pct\": %u, \"vm_hwm_kb\": %ld}",
+            (unsigned)((mon.total_size - mon.free_size) / 1024), (unsigned)(mon.max_used / 1024),
+            (unsigned)mon.frag_pct, vm_hwm_kb());
+}
+
+int main(int argc, char **argv)
+{
+    int frames = 200, warmup = 10;
+    std::string only, output, assets;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (arg == "--frames")
+            frames = atoi(argv[++i]);
+        else if (arg == "--warmup")
+            warmup = atoi(argv[++i]);
+        else if (arg == "--scenario")
+            only = argv[++i];
+        else if (arg == "--assets")
+            assets = argv[++i];
+        else if (arg == "--output")
+            output = argv[++i];
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    lv_init();
+
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    std::vector<lv_color_t> buf1(DISP_HOR_RES * DISP_VER_RES), buf2(DISP_HOR_RES * DISP_VER_RES);
+    lv_disp_draw_buf_init(&draw_buf, buf1.data(), buf2.data(), DISP_HOR_RES * DISP_VER_RES);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.hor_res = DISP_HOR_RES;
+    disp_drv.ver_res = DISP_VER_RES;
+    disp_drv.direct_mode = 1;
+    disp_drv.flush_cb = mem_flush;
+    disp_drv.draw_ctx_init = bench_draw_ctx_init;
+    lv_disp_drv_register(&disp_drv);
+    lv_img_cache_set_size(10);
+
+    /* the images of ASSET_PACK=1 builds */
+    if (!assets.empty() && asset_pack_open(assets.c_str()))
+        return 1;
+
+    double start = now_ms();
+    setup_ui(&guider_ui);
+    events_init(&guider_ui);
+    custom_init(&guider_ui);
+    double setup_ms = now_ms() - start;
+
+    start = now_ms();
+    lv_refr_now(NULL);
+    double first_frame_ms = now_ms() - start;
+
+    FILE *out = output.empty() ? stdout : fopen(output.c_str(), "w");
+    if (!out) {
+        printf("Cannot open %s\n", output.c_str());
+        return 1;
+    }
+    fprintf(out, "{\n  \"display\": \"%dx%d\",\n  \"setup_ui_ms\": %.3f,\n  \"first_frame_ms\": %.3f,\n",
+            DISP_HOR_RES, DISP_VER_RES, setup_ms, first_frame_ms);
+    fprintf(out, "  \"mem_after_setup\": ");
+    print_mem_json(out);
+    fprintf(out, ",\n  \"scenarios\": {");
+
+    bool first = true;
+    for (const Scenario &sc : scenarios) {
+        if (!only.empty() && only != sc.name)
+            continue;
+
+        sc.setup();
+        lv_refr_now(NULL);
+        for (int i = 0; i < warmup; i++) {
+            if (sc.prepare)
+                sc.prepare(i);
+            sc.frame(i);
+            lv_refr_now(NULL);
+        }
+
+        std::vector<double> update, render, pixels, blend, copy;
+        for (int i = 0; i < frames; i++) {
+            if (sc.prepare)
+                sc.prepare(warmup + i);
+            start = now_ms();
+            sc.frame(warmup + i);
+            update.push_back(now_ms() - start);
+            flushed_px = img_blend_px = img_copy_px = 0;
+            start = now_ms();
+            lv_refr_now(NULL);
+            render.push_back(now_ms() - start);
+            pixels.push_back(flushed_px);
+            blend.push_back(img_blend_px);
+            copy.push_back(img_copy_px);
+        }
+
+        fprintf(out, "%s\n    \"%s\": {\n      \"frames\": %d,\n", first ? "" : ",", sc.name, frames);
+        fprintf(out, "      \"update_ms\": "); print_latency_json(out, update); fprintf(out, ",\n");
+        fprintf(out, "      \"render_ms\": "); print_latency_json(out, render); fprintf(out, ",\n");
+        fprintf(out, "      \"flushed_px\": "); print_latency_json(out, pixels); fprintf(out, ",\n");
+        fprintf(out, "      \"img_blend_px\": "); print_latency_json(out, blend); fprintf(out, ",\n");
+        fprintf(out, "      \"img_copy_px\": "); print_latency_json(out, copy); fprintf(out, ",\n");
+        fprintf(out, "      \"mem\": "); print_mem_json(out); fprintf(out, "\n    }");
+        first = false;
+    }
+    fprintf(out, "\n  }\n}\n");
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}